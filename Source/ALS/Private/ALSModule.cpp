@@ -54,6 +54,11 @@ void FALSModule::Console_OnRegisterAutoCompleteEntries(TArray<FAutoCompleteComma
 	Command->Desc = FString{TEXTVIEW("Displays ALS performance statistics.")};
 	Command->Color = CommandColor;
 
+	Command = &AutoCompleteCommands.AddDefaulted_GetRef();
+	Command->Command = FString{TEXTVIEW("Als.NetworkStats.Dump")};
+	Command->Desc = FString{TEXTVIEW("Displays the estimated network cost of ALS replicated properties and RPCs.")};
+	Command->Color = CommandColor;
+
 	Command = &AutoCompleteCommands.AddDefaulted_GetRef();
 	Command->Command = FString{TEXTVIEW("ShowDebug Als.Curves")};
 	Command->Desc = FString{TEXTVIEW("Displays animation curves.")};
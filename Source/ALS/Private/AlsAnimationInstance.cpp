@@ -2,16 +2,21 @@
 
 #include "AlsAnimationInstanceProxy.h"
 #include "AlsCharacter.h"
+#include "AlsSceneQuerySubsystem.h"
 #include "DrawDebugHelpers.h"
+#include "Animation/AnimMontage.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Curves/CurveFloat.h"
 #include "Engine/SkeletalMesh.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "PhysicsEngine/PhysicsAsset.h"
 #include "Settings/AlsAnimationInstanceSettings.h"
 #include "Settings/AlsCharacterSettings.h"
 #include "Utility/AlsConstants.h"
 #include "Utility/AlsDebugUtility.h"
+#include "Utility/AlsFootSolverBatch.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsPrivateMemberAccessor.h"
 #include "Utility/AlsRotation.h"
@@ -104,48 +109,46 @@ void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 		return;
 	}
 
-	auto* Mesh{GetSkelMeshComponent()};
-
-	if (Mesh->IsUsingAbsoluteRotation() && IsValid(Mesh->GetAttachParent()))
-	{
-		const auto& ParentTransform{Mesh->GetAttachParent()->GetComponentTransform()};
-
-		// Manually synchronize mesh rotation with character rotation.
-
-		Mesh->MoveComponent(FVector::ZeroVector, ParentTransform.GetRotation() * Character->GetBaseRotationOffset(), false);
+#if WITH_EDITORONLY_DATA && ENABLE_DRAW_DEBUG
+	bDisplayDebugTraces = UAlsDebugUtility::ShouldDisplayDebugForActor(Character, UAlsConstants::TracesDebugDisplayName());
+#endif
 
-		// Re-cache proxy transforms to match the modified mesh transform.
+	// The snapshot is usually taken at the end of the character tick, but the animation
+	// can also be updated outside of it, for example, when the character tick is disabled.
 
-		const auto& Proxy{GetProxyOnGameThread<FAnimInstanceProxy>()};
-		const_cast<FTransform&>(Proxy.GetComponentTransform()) = Mesh->GetComponentTransform();
-		const_cast<FTransform&>(Proxy.GetComponentRelativeTransform()) = Mesh->GetRelativeTransform();
-		const_cast<FTransform&>(Proxy.GetActorTransform()) = Character->GetActorTransform();
+	if (Character->GetSnapshot().FrameNumber != GFrameCounter)
+	{
+		Character->RefreshSnapshot();
 	}
 
-#if WITH_EDITORONLY_DATA && ENABLE_DRAW_DEBUG
-	bDisplayDebugTraces = UAlsDebugUtility::ShouldDisplayDebugForActor(Character, UAlsConstants::TracesDebugDisplayName());
-#endif
+	CharacterSnapshot = Character->GetSnapshot();
 
-	ViewMode = Character->GetViewMode();
-	LocomotionMode = Character->GetLocomotionMode();
-	RotationMode = Character->GetRotationMode();
-	Stance = Character->GetStance();
-	Gait = Character->GetGait();
-	OverlayMode = Character->GetOverlayMode();
+	ViewMode = CharacterSnapshot.ViewMode;
+	LocomotionMode = CharacterSnapshot.LocomotionMode;
+	RotationMode = CharacterSnapshot.RotationMode;
+	Stance = CharacterSnapshot.Stance;
+	Gait = CharacterSnapshot.Gait;
+	OverlayMode = CharacterSnapshot.OverlayMode;
 
-	if (LocomotionAction != Character->GetLocomotionAction())
+	if (LocomotionAction != CharacterSnapshot.LocomotionAction)
 	{
-		LocomotionAction = Character->GetLocomotionAction();
+		LocomotionAction = CharacterSnapshot.LocomotionAction;
 		ResetGroundedEntryMode();
 	}
 
 	const auto PreviousLocation{LocomotionState.Location};
 
+	RefreshLodOnGameThread();
 	RefreshMovementBaseOnGameThread();
 	RefreshViewOnGameThread();
 	RefreshLocomotionOnGameThread();
 	RefreshInAirOnGameThread();
-	RefreshFeetOnGameThread();
+
+	if (!LodState.bFeetDisabled)
+	{
+		RefreshFeetOnGameThread();
+	}
+
 	RefreshRagdollingOnGameThread();
 
 	if (!bPendingUpdate && IsValid(Character->GetSettings()) &&
@@ -173,10 +176,19 @@ void UAlsAnimationInstance::NativeThreadSafeUpdateAnimation(const float DeltaTim
 	RotateInPlaceState.bUpdatedThisFrame = false;
 	TurnInPlaceState.bUpdatedThisFrame = false;
 
-	RefreshLayering();
+	if (!LodState.bLayeringDisabled)
+	{
+		RefreshLayering();
+	}
+
 	RefreshPose();
 	RefreshView(DeltaTime);
-	RefreshFeet(DeltaTime);
+
+	if (!LodState.bFeetDisabled)
+	{
+		RefreshFeet(DeltaTime);
+	}
+
 	RefreshTransitions();
 }
 
@@ -201,13 +213,12 @@ void UAlsAnimationInstance::NativePostUpdateAnimation()
 #if WITH_EDITORONLY_DATA && ENABLE_DRAW_DEBUG
 	if (!bPendingUpdate)
 	{
-		for (const auto& DisplayDebugTraceFunction : DisplayDebugTracesQueue)
-		{
-			DisplayDebugTraceFunction();
-		}
+		DisplayDebugTracesBuffer.Flush(this);
+	}
+	else
+	{
+		DisplayDebugTracesBuffer.Reset();
 	}
-
-	DisplayDebugTracesQueue.Reset();
 #endif
 
 	bPendingUpdate = false;
@@ -234,14 +245,103 @@ FAlsControlRigInput UAlsAnimationInstance::GetControlRigInput() const
 	};
 }
 
-void UAlsAnimationInstance::RefreshMovementBaseOnGameThread()
+void UAlsAnimationInstance::CopyStateFrom(const UAlsAnimationInstance* Other)
+{
+	check(IsInGameThread())
+
+	if (!ALS_ENSURE(IsValid(Other)) || Other == this)
+	{
+		return;
+	}
+
+	// The level of detail and the character snapshot are intentionally not copied, they will be refreshed
+	// on the next update anyway. Everything else is copied to avoid visible pops caused by re-initialization.
+
+	bPendingUpdate = Other->bPendingUpdate;
+	TeleportedTime = Other->TeleportedTime;
+
+	ViewMode = Other->ViewMode;
+	LocomotionMode = Other->LocomotionMode;
+	RotationMode = Other->RotationMode;
+	Stance = Other->Stance;
+	Gait = Other->Gait;
+	OverlayMode = Other->OverlayMode;
+	LocomotionAction = Other->LocomotionAction;
+	GroundedEntryMode = Other->GroundedEntryMode;
+
+	MovementBase = Other->MovementBase;
+	LayeringState = Other->LayeringState;
+	PoseState = Other->PoseState;
+	ViewState = Other->ViewState;
+	SpineState = Other->SpineState;
+	LookState = Other->LookState;
+	LocomotionState = Other->LocomotionState;
+	LeanState = Other->LeanState;
+	GroundedState = Other->GroundedState;
+	StandingState = Other->StandingState;
+	CrouchingState = Other->CrouchingState;
+	InAirState = Other->InAirState;
+	FeetState = Other->FeetState;
+	TransitionsState = Other->TransitionsState;
+	DynamicTransitionsState = Other->DynamicTransitionsState;
+	RotateInPlaceState = Other->RotateInPlaceState;
+	TurnInPlaceState = Other->TurnInPlaceState;
+	RagdollingState = Other->RagdollingState;
+
+	DynamicMontagesCache = Other->DynamicMontagesCache;
+}
+
+void UAlsAnimationInstance::RefreshLodOnGameThread()
 {
-	const auto& BasedMovement{Character->GetBasedMovement()};
+	check(IsInGameThread())
 
-	if (BasedMovement.MovementBase != MovementBase.Primitive || BasedMovement.BoneName != MovementBase.BoneName)
+	LodState.LodLevel = GetSkelMeshComponent()->GetPredictedLODLevel();
+
+	LodState.bLayeringDisabled = false;
+	LodState.bFeetDisabled = false;
+	LodState.bFootLockDisabled = false;
+	LodState.bDynamicTransitionsDisabled = false;
+	LodState.bTransitionsDisabled = false;
+	LodState.bLookDisabled = false;
+	LodState.bRotateInPlaceDisabled = false;
+	LodState.bTurnInPlaceDisabled = false;
+	LodState.bGroundPredictionDisabled = false;
+	LodState.bLeanDisabled = false;
+	LodState.LeanUpdateInterval = 1;
+
+	bGameplayOnlyUpdate = Settings->General.bGameplayOnlyUpdateOnDedicatedServer && Character->IsNetMode(NM_DedicatedServer);
+
+	if (bGameplayOnlyUpdate)
+	{
+		LodState.bFeetDisabled = true;
+		LodState.bFootLockDisabled = true;
+		LodState.bDynamicTransitionsDisabled = true;
+		LodState.bLookDisabled = true;
+		LodState.bGroundPredictionDisabled = true;
+		LodState.bLeanDisabled = true;
+		return;
+	}
+
+	const auto* Features{Settings->Lod.bEnableLodFeatures ? Settings->Lod.FindFeatures(LodState.LodLevel) : nullptr};
+	if (Features != nullptr)
 	{
-		MovementBase.Primitive = BasedMovement.MovementBase;
-		MovementBase.BoneName = BasedMovement.BoneName;
+		LodState.bFootLockDisabled = Features->bDisableFootLock;
+		LodState.bDynamicTransitionsDisabled = Features->bDisableDynamicTransitions;
+		LodState.bTransitionsDisabled = Features->bDisableTransitions;
+		LodState.bLookDisabled = Features->bDisableLook;
+		LodState.bRotateInPlaceDisabled = Features->bDisableRotateInPlace;
+		LodState.bTurnInPlaceDisabled = Features->bDisableTurnInPlace;
+		LodState.LeanUpdateInterval = FMath::Max(1, Features->LeanUpdateInterval);
+	}
+}
+
+void UAlsAnimationInstance::RefreshMovementBaseOnGameThread()
+{
+	if (CharacterSnapshot.MovementBasePrimitive != MovementBase.Primitive ||
+	    CharacterSnapshot.MovementBaseBoneName != MovementBase.BoneName)
+	{
+		MovementBase.Primitive = CharacterSnapshot.MovementBasePrimitive;
+		MovementBase.BoneName = CharacterSnapshot.MovementBaseBoneName;
 		MovementBase.bBaseChanged = true;
 	}
 	else
@@ -249,13 +349,13 @@ void UAlsAnimationInstance::RefreshMovementBaseOnGameThread()
 		MovementBase.bBaseChanged = false;
 	}
 
-	MovementBase.bHasRelativeLocation = BasedMovement.HasRelativeLocation();
-	MovementBase.bHasRelativeRotation = MovementBase.bHasRelativeLocation && BasedMovement.bRelativeRotation;
+	MovementBase.bHasRelativeLocation = CharacterSnapshot.bMovementBaseHasRelativeLocation;
+	MovementBase.bHasRelativeRotation = CharacterSnapshot.bMovementBaseHasRelativeRotation;
 
 	const auto PreviousRotation{MovementBase.Rotation};
 
-	MovementBaseUtility::GetMovementBaseTransform(BasedMovement.MovementBase, BasedMovement.BoneName,
-	                                              MovementBase.Location, MovementBase.Rotation);
+	MovementBase.Location = CharacterSnapshot.MovementBaseLocation;
+	MovementBase.Rotation = CharacterSnapshot.MovementBaseRotation;
 
 	MovementBase.DeltaRotation = MovementBase.bHasRelativeLocation && !MovementBase.bBaseChanged
 		                             ? (MovementBase.Rotation * PreviousRotation.Inverse()).Rotator()
@@ -355,10 +455,8 @@ void UAlsAnimationInstance::RefreshViewOnGameThread()
 {
 	check(IsInGameThread())
 
-	const auto& View{Character->GetViewState()};
-
-	ViewState.Rotation = View.Rotation;
-	ViewState.YawSpeed = View.YawSpeed;
+	ViewState.Rotation = CharacterSnapshot.ViewRotation;
+	ViewState.YawSpeed = CharacterSnapshot.ViewYawSpeed;
 }
 
 void UAlsAnimationInstance::RefreshView(const float DeltaTime)
@@ -513,6 +611,14 @@ void UAlsAnimationInstance::RefreshLook()
 		return;
 	}
 
+	if (LodState.bLookDisabled)
+	{
+		// Keep the current look state and reinitialize it when the look is enabled again.
+
+		LookState.bInitializationRequired = true;
+		return;
+	}
+
 	const auto ActorYawAngle{UE_REAL_TO_FLOAT(LocomotionState.Rotation.Yaw)};
 
 	if (MovementBase.bHasRelativeRotation)
@@ -591,36 +697,32 @@ void UAlsAnimationInstance::RefreshLocomotionOnGameThread()
 
 	const auto* World{GetWorld()};
 
-	const auto ActorDeltaTime{IsValid(World) ? World->GetDeltaSeconds() * Character->CustomTimeDilation : 0.0f};
+	const auto ActorDeltaTime{IsValid(World) ? World->GetDeltaSeconds() * CharacterSnapshot.CustomTimeDilation : 0.0f};
 	const auto bCanCalculateRateOfChange{!bPendingUpdate && ActorDeltaTime > UE_SMALL_NUMBER};
 
-	const auto& Locomotion{Character->GetLocomotionState()};
-
-	LocomotionState.bHasInput = Locomotion.bHasInput;
-	LocomotionState.InputYawAngle = Locomotion.InputYawAngle;
+	LocomotionState.bHasInput = CharacterSnapshot.bHasInput;
+	LocomotionState.InputYawAngle = CharacterSnapshot.InputYawAngle;
 
 	const auto PreviousVelocity{LocomotionState.Velocity};
 
-	LocomotionState.Speed = Locomotion.Speed;
-	LocomotionState.Velocity = Locomotion.Velocity;
-	LocomotionState.VelocityYawAngle = Locomotion.VelocityYawAngle;
+	LocomotionState.Speed = CharacterSnapshot.Speed;
+	LocomotionState.Velocity = CharacterSnapshot.Velocity;
+	LocomotionState.VelocityYawAngle = CharacterSnapshot.VelocityYawAngle;
 
 	LocomotionState.Acceleration = bCanCalculateRateOfChange
 		                               ? (LocomotionState.Velocity - PreviousVelocity) / ActorDeltaTime
 		                               : FVector::ZeroVector;
 
-	const auto* Movement{Character->GetCharacterMovement()};
+	LocomotionState.MaxAcceleration = CharacterSnapshot.MaxAcceleration;
+	LocomotionState.MaxBrakingDeceleration = CharacterSnapshot.MaxBrakingDeceleration;
+	LocomotionState.WalkableFloorAngleCos = CharacterSnapshot.WalkableFloorAngleCos;
 
-	LocomotionState.MaxAcceleration = Movement->GetMaxAcceleration();
-	LocomotionState.MaxBrakingDeceleration = Movement->GetMaxBrakingDeceleration();
-	LocomotionState.WalkableFloorAngleCos = Movement->GetWalkableFloorZ();
+	LocomotionState.bMoving = CharacterSnapshot.bMoving;
 
-	LocomotionState.bMoving = Locomotion.bMoving;
+	LocomotionState.bMovingSmooth = (CharacterSnapshot.bHasInput && CharacterSnapshot.bHasVelocity) ||
+	                                CharacterSnapshot.Speed > Settings->General.MovingSmoothSpeedThreshold;
 
-	LocomotionState.bMovingSmooth = (Locomotion.bHasInput && Locomotion.bHasVelocity) ||
-	                                Locomotion.Speed > Settings->General.MovingSmoothSpeedThreshold;
-
-	LocomotionState.TargetYawAngle = Locomotion.TargetYawAngle;
+	LocomotionState.TargetYawAngle = CharacterSnapshot.TargetYawAngle;
 
 	const auto PreviousYawAngle{LocomotionState.Rotation.Yaw};
 
@@ -628,14 +730,7 @@ void UAlsAnimationInstance::RefreshLocomotionOnGameThread()
 	const auto& ActorTransform{Proxy.GetActorTransform()};
 	const auto& MeshRelativeTransform{Proxy.GetComponentRelativeTransform()};
 
-	static const auto* EnableListenServerSmoothingConsoleVariable{
-		IConsoleManager::Get().FindConsoleVariable(TEXT("p.NetEnableListenServerSmoothing"))
-	};
-	check(EnableListenServerSmoothingConsoleVariable != nullptr)
-
-	if (Movement->NetworkSmoothingMode == ENetworkSmoothingMode::Disabled ||
-	    (Character->GetLocalRole() != ROLE_SimulatedProxy &&
-	     !(Character->IsNetMode(NM_ListenServer) && EnableListenServerSmoothingConsoleVariable->GetBool())))
+	if (!CharacterSnapshot.bNetworkSmoothingActive)
 	{
 		// If the network smoothing is disabled, use the regular actor transform.
 
@@ -646,7 +741,7 @@ void UAlsAnimationInstance::RefreshLocomotionOnGameThread()
 	else if (GetSkelMeshComponent()->IsUsingAbsoluteRotation())
 	{
 		LocomotionState.Location = ActorTransform.TransformPosition(
-			MeshRelativeTransform.GetLocation() - Character->GetBaseTranslationOffset());
+			MeshRelativeTransform.GetLocation() - CharacterSnapshot.BaseTranslationOffset);
 
 		LocomotionState.Rotation = ActorTransform.Rotator();
 		LocomotionState.RotationQuaternion = ActorTransform.GetRotation();
@@ -655,8 +750,8 @@ void UAlsAnimationInstance::RefreshLocomotionOnGameThread()
 	{
 		const auto SmoothTransform{
 			ActorTransform * FTransform{
-				MeshRelativeTransform.GetRotation() * Character->GetBaseRotationOffset().Inverse(),
-				MeshRelativeTransform.GetLocation() - Character->GetBaseTranslationOffset()
+				MeshRelativeTransform.GetRotation() * CharacterSnapshot.BaseRotationOffset.Inverse(),
+				MeshRelativeTransform.GetLocation() - CharacterSnapshot.BaseTranslationOffset
 			}
 		};
 
@@ -672,10 +767,8 @@ void UAlsAnimationInstance::RefreshLocomotionOnGameThread()
 
 	LocomotionState.Scale = UE_REAL_TO_FLOAT(Proxy.GetComponentTransform().GetScale3D().Z);
 
-	const auto* Capsule{Character->GetCapsuleComponent()};
-
-	LocomotionState.CapsuleRadius = Capsule->GetScaledCapsuleRadius();
-	LocomotionState.CapsuleHalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+	LocomotionState.CapsuleRadius = CharacterSnapshot.CapsuleRadius;
+	LocomotionState.CapsuleHalfHeight = CharacterSnapshot.CapsuleHalfHeight;
 }
 
 void UAlsAnimationInstance::InitializeLean()
@@ -789,8 +882,46 @@ void UAlsAnimationInstance::RefreshVelocityBlend()
 	}
 }
 
+bool UAlsAnimationInstance::ShouldRefreshLean(int32& SkippedUpdatesCount, float& SkippedDeltaTime, float& DeltaTime) const
+{
+	DeltaTime = GetDeltaSeconds();
+
+	if (LodState.bLeanDisabled)
+	{
+		return false;
+	}
+
+	if (bPendingUpdate || LodState.LeanUpdateInterval <= 1)
+	{
+		SkippedUpdatesCount = 0;
+		SkippedDeltaTime = 0.0f;
+		return true;
+	}
+
+	if (SkippedUpdatesCount + 1 < LodState.LeanUpdateInterval)
+	{
+		SkippedUpdatesCount += 1;
+		SkippedDeltaTime += DeltaTime;
+		return false;
+	}
+
+	// Include the time of the skipped updates so that the interpolation speed does not depend on the update interval.
+
+	DeltaTime += SkippedDeltaTime;
+
+	SkippedUpdatesCount = 0;
+	SkippedDeltaTime = 0.0f;
+	return true;
+}
+
 void UAlsAnimationInstance::RefreshGroundedLean()
 {
+	float DeltaTime;
+	if (!ShouldRefreshLean(LodState.GroundedLeanSkippedUpdatesCount, LodState.GroundedLeanSkippedDeltaTime, DeltaTime))
+	{
+		return;
+	}
+
 	const auto TargetLeanAmount{GetRelativeAccelerationAmount()};
 
 	if (bPendingUpdate || Settings->General.LeanInterpolationHalfLife <= 0.0f)
@@ -800,7 +931,7 @@ void UAlsAnimationInstance::RefreshGroundedLean()
 	}
 	else
 	{
-		const auto InterpolationAmount{UAlsMath::DamperExactAlpha(GetDeltaSeconds(), Settings->General.LeanInterpolationHalfLife)};
+		const auto InterpolationAmount{UAlsMath::DamperExactAlpha(DeltaTime, Settings->General.LeanInterpolationHalfLife)};
 
 		LeanState.RightAmount = FMath::Lerp(LeanState.RightAmount, TargetLeanAmount.Y, InterpolationAmount);
 		LeanState.ForwardAmount = FMath::Lerp(LeanState.ForwardAmount, TargetLeanAmount.X, InterpolationAmount);
@@ -1026,7 +1157,15 @@ void UAlsAnimationInstance::RefreshInAir()
 
 	InAirState.VerticalVelocity = UE_REAL_TO_FLOAT(LocomotionState.Velocity.Z);
 
-	RefreshGroundPrediction();
+	if (LodState.bGroundPredictionDisabled)
+	{
+		InAirState.GroundPredictionAmount = 0.0f;
+	}
+	else
+	{
+		RefreshGroundPrediction();
+	}
+
 	RefreshInAirLean();
 }
 
@@ -1053,6 +1192,15 @@ void UAlsAnimationInstance::RefreshGroundPrediction()
 
 	const auto SweepStartLocation{LocomotionState.Location};
 
+	// Keep the previous ground prediction amount if the scene query budget is exhausted.
+
+	if (!UAlsSceneQuerySubsystem::TryAcquireQueriesInWorld(GetWorld(), Character, SweepStartLocation,
+	                                                       EAlsSceneQueryCategory::GroundPrediction,
+	                                                       &InAirState.DeferredQueriesCount))
+	{
+		return;
+	}
+
 	static constexpr auto MinVerticalVelocity{-4000.0f};
 	static constexpr auto MaxVerticalVelocity{-200.0f};
 
@@ -1088,13 +1236,9 @@ void UAlsAnimationInstance::RefreshGroundPrediction()
 		}
 		else
 		{
-			DisplayDebugTracesQueue.Emplace([this, Hit, bGroundValid]
-				{
-					UAlsDebugUtility::DrawSweepSingleCapsule(GetWorld(), Hit.TraceStart, Hit.TraceEnd, FRotator::ZeroRotator,
-					                                         LocomotionState.CapsuleRadius, LocomotionState.CapsuleHalfHeight,
-					                                         bGroundValid, Hit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f});
-				}
-			);
+			DisplayDebugTracesBuffer.AddSweepCapsule(Hit.TraceStart, Hit.TraceEnd, FRotator::ZeroRotator,
+			                                         LocomotionState.CapsuleRadius, LocomotionState.CapsuleHalfHeight,
+			                                         bGroundValid, Hit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f});
 		}
 	}
 #endif
@@ -1110,6 +1254,12 @@ void UAlsAnimationInstance::RefreshInAirLean()
 	// while in air. The lean amount curve gets the vertical velocity and is used as a multiplier to
 	// smoothly reverse the leaning direction when transitioning from moving upwards to moving downwards.
 
+	float DeltaTime;
+	if (!ShouldRefreshLean(LodState.InAirLeanSkippedUpdatesCount, LodState.InAirLeanSkippedDeltaTime, DeltaTime))
+	{
+		return;
+	}
+
 	static constexpr auto ReferenceSpeed{350.0f};
 
 	const auto TargetLeanAmount{
@@ -1123,7 +1273,7 @@ void UAlsAnimationInstance::RefreshInAirLean()
 	}
 	else
 	{
-		const auto InterpolationAmount{UAlsMath::DamperExactAlpha(GetDeltaSeconds(), Settings->General.LeanInterpolationHalfLife)};
+		const auto InterpolationAmount{UAlsMath::DamperExactAlpha(DeltaTime, Settings->General.LeanInterpolationHalfLife)};
 
 		LeanState.RightAmount = FMath::Lerp(LeanState.RightAmount, TargetLeanAmount.Y, InterpolationAmount);
 		LeanState.ForwardAmount = FMath::Lerp(LeanState.ForwardAmount, TargetLeanAmount.X, InterpolationAmount);
@@ -1159,32 +1309,96 @@ void UAlsAnimationInstance::RefreshFeetOnGameThread()
 
 void UAlsAnimationInstance::RefreshFeet(const float DeltaTime)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::RefreshFeet"), STAT_UAlsAnimationInstance_RefreshFeet, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	FeetState.FootPlantedAmount = FMath::Clamp(GetCurveValue(UAlsConstants::FootPlantedCurveName()), -1.0f, 1.0f);
 	FeetState.FeetCrossingAmount = GetCurveValueClamped01(UAlsConstants::FeetCrossingCurveName());
 
 	const auto ComponentTransform{GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform()};
 
+	// Values shared by both feet are calculated only once here, instead of being recalculated for each foot.
+
 	FAlsFootUpdateContext Context{
 		.ComponentTransform{ComponentTransform},
 		.ComponentTransformInverse{ComponentTransform.Inverse()},
+		.MovementBaseRotationInverse{MovementBase.bHasRelativeLocation ? MovementBase.Rotation.Inverse() : FQuat::Identity},
 		.DeltaTime = DeltaTime
 	};
 
-	Context.FootState = &FeetState.Left;
-	Context.IkAmount = GetCurveValueClamped01(UAlsConstants::FootLeftIkCurveName());
-	Context.LockAmount = GetCurveValueClamped01(UAlsConstants::FootLeftLockCurveName());
+	static constexpr auto FeetCount{2};
+	static_assert(FeetCount <= FAlsFootSolverBatch::LanesCount);
+
+	FAlsFootState* FootStates[FeetCount]{&FeetState.Left, &FeetState.Right};
+
+	const float IkAmounts[FeetCount]{
+		GetCurveValueClamped01(UAlsConstants::FootLeftIkCurveName()),
+		GetCurveValueClamped01(UAlsConstants::FootRightIkCurveName())
+	};
+
+	const float LockAmounts[FeetCount]{
+		GetCurveValueClamped01(UAlsConstants::FootLeftLockCurveName()),
+		GetCurveValueClamped01(UAlsConstants::FootRightLockCurveName())
+	};
+
+	// The foot lock state of each foot is refreshed separately, since it branches differently for each foot, and then the
+	// conversion to component space and the final blending are performed for both feet at once in a structure-of-arrays batch.
+
+	FAlsFootSolverBatch TargetBatch;
+	FAlsFootSolverBatch LockBatch;
+	double FinalLockAmounts[FAlsFootSolverBatch::LanesCount]{};
+	bool bFootLocked[FeetCount];
+
+	for (auto i{0}; i < FeetCount; i++)
+	{
+		Context.FootState = FootStates[i];
+		Context.IkAmount = IkAmounts[i];
+		Context.LockAmount = LockAmounts[i];
+
+		ProcessFootLockTeleport(Context);
+		ProcessFootLockBaseChange(Context);
+		bFootLocked[i] = RefreshFootLock(Context);
+
+		TargetBatch.Set(i, Context.FootState->TargetLocation, Context.FootState->TargetRotation);
+		LockBatch.Set(i, Context.FootState->LockLocation, Context.FootState->LockRotation);
+	}
+
+	TargetBatch.TransformBy(Context.ComponentTransformInverse);
+	LockBatch.TransformBy(Context.ComponentTransformInverse);
+
+	for (auto i{0}; i < FeetCount; i++)
+	{
+		auto& FootState{*FootStates[i]};
+
+		if (!bFootLocked[i])
+		{
+			// Blending with the target itself keeps the final transform equal to the target transform.
+
+			LockBatch.Set(i, TargetBatch.GetLocation(i), TargetBatch.GetRotation(i));
+			continue;
+		}
+
+		FootState.LockComponentRelativeLocation = FVector3f{LockBatch.GetLocation(i)};
+		FootState.LockComponentRelativeRotation = FQuat4f{LockBatch.GetRotation(i)};
+
+		Context.FootState = &FootState;
+
+		if (LimitFootLockAngle(Context))
+		{
+			LockBatch.Set(i, FVector{FootState.LockComponentRelativeLocation}, FQuat{FootState.LockComponentRelativeRotation});
+		}
 
-	ProcessFootLockTeleport(Context);
-	ProcessFootLockBaseChange(Context);
-	RefreshFootLock(Context);
+		FinalLockAmounts[i] = FootState.LockAmount;
+	}
 
-	Context.FootState = &FeetState.Right;
-	Context.IkAmount = GetCurveValueClamped01(UAlsConstants::FootRightIkCurveName());
-	Context.LockAmount = GetCurveValueClamped01(UAlsConstants::FootRightLockCurveName());
+	FAlsFootSolverBatch FinalBatch;
+	FAlsFootSolverBatch::Blend(TargetBatch, LockBatch, FinalLockAmounts, FinalBatch);
 
-	ProcessFootLockTeleport(Context);
-	ProcessFootLockBaseChange(Context);
-	RefreshFootLock(Context);
+	for (auto i{0}; i < FeetCount; i++)
+	{
+		FootStates[i]->FinalLocation = FVector3f{FinalBatch.GetLocation(i)};
+		FootStates[i]->FinalRotation = FQuat4f{FinalBatch.GetRotation(i)};
+	}
 }
 
 void UAlsAnimationInstance::ProcessFootLockTeleport(const FAlsFootUpdateContext& Context) const
@@ -1206,7 +1420,7 @@ void UAlsAnimationInstance::ProcessFootLockTeleport(const FAlsFootUpdateContext&
 
 	if (MovementBase.bHasRelativeLocation)
 	{
-		const auto BaseRotationInverse{MovementBase.Rotation.Inverse()};
+		const auto& BaseRotationInverse{Context.MovementBaseRotationInverse};
 
 		FootState.LockMovementBaseRelativeLocation =
 			FVector3f{BaseRotationInverse.RotateVector(FootState.LockLocation - MovementBase.Location)};
@@ -1236,7 +1450,7 @@ void UAlsAnimationInstance::ProcessFootLockBaseChange(const FAlsFootUpdateContex
 
 	if (MovementBase.bHasRelativeLocation)
 	{
-		const auto BaseRotationInverse{MovementBase.Rotation.Inverse()};
+		const auto& BaseRotationInverse{Context.MovementBaseRotationInverse};
 
 		FootState.LockMovementBaseRelativeLocation =
 			FVector3f{BaseRotationInverse.RotateVector(FootState.LockLocation - MovementBase.Location)};
@@ -1250,7 +1464,7 @@ void UAlsAnimationInstance::ProcessFootLockBaseChange(const FAlsFootUpdateContex
 	}
 }
 
-void UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context) const
+bool UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context) const
 {
 	auto& FootState{*Context.FootState};
 	auto NewLockAmount{Context.LockAmount};
@@ -1271,7 +1485,7 @@ void UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context
 				                             (LocomotionState.bMovingSmooth ? MovingDecreaseSpeed : NotGroundedDecreaseSpeed)));
 	}
 
-	if (Settings->Feet.bDisableFootLock || !FAnimWeight::IsRelevant(Context.IkAmount * NewLockAmount))
+	if (Settings->Feet.bDisableFootLock || LodState.bFootLockDisabled || !FAnimWeight::IsRelevant(Context.IkAmount * NewLockAmount))
 	{
 		if (FootState.LockAmount > 0.0f)
 		{
@@ -1287,9 +1501,7 @@ void UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context
 			FootState.LockMovementBaseRelativeRotation = FQuat4f::Identity;
 		}
 
-		FootState.FinalLocation = FVector3f{Context.ComponentTransformInverse.TransformPosition(FootState.TargetLocation)};
-		FootState.FinalRotation = FQuat4f{Context.ComponentTransformInverse.TransformRotation(FootState.TargetRotation)};
-		return;
+		return false;
 	}
 
 	const auto bNewAmountEqualOne{FAnimWeight::IsFullWeight(NewLockAmount)};
@@ -1338,7 +1550,7 @@ void UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context
 
 			if (MovementBase.bHasRelativeLocation)
 			{
-				const auto BaseRotationInverse{MovementBase.Rotation.Inverse()};
+				const auto& BaseRotationInverse{Context.MovementBaseRotationInverse};
 
 				FootState.LockMovementBaseRelativeLocation =
 					FVector3f{BaseRotationInverse.RotateVector(TargetLocation - MovementBase.Location)};
@@ -1367,46 +1579,44 @@ void UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context
 		FootState.LockRotation = MovementBase.Rotation * FQuat{FootState.LockMovementBaseRelativeRotation};
 	}
 
-	FootState.LockComponentRelativeLocation = FVector3f{Context.ComponentTransformInverse.TransformPosition(FootState.LockLocation)};
-	FootState.LockComponentRelativeRotation = FQuat4f{Context.ComponentTransformInverse.TransformRotation(FootState.LockRotation)};
+	return true;
+}
+
+bool UAlsAnimationInstance::LimitFootLockAngle(const FAlsFootUpdateContext& Context) const
+{
+	auto& FootState{*Context.FootState};
 
 	// Limit the foot lock location so that legs do not twist into a spiral when the actor rotates quickly.
 
 	const auto ComponentRelativeThighAxis{FeetState.PelvisRotation.RotateVector(FootState.ThighAxis)};
 	const auto LockAngle{UAlsVector::AngleBetweenSignedXY(ComponentRelativeThighAxis, FootState.LockComponentRelativeLocation)};
 
-	if (FMath::Abs(LockAngle) > Settings->Feet.FootLockAngleLimit + UE_KINDA_SMALL_NUMBER)
+	if (FMath::Abs(LockAngle) <= Settings->Feet.FootLockAngleLimit + UE_KINDA_SMALL_NUMBER)
 	{
-		const auto ConstrainedLockAngle{FMath::Clamp(LockAngle, -Settings->Feet.FootLockAngleLimit, Settings->Feet.FootLockAngleLimit)};
-		const FQuat4f OffsetRotation{FVector3f::ZAxisVector, FMath::DegreesToRadians(ConstrainedLockAngle - LockAngle)};
+		return false;
+	}
 
-		FootState.LockComponentRelativeLocation = OffsetRotation.RotateVector(FootState.LockComponentRelativeLocation);
-		FootState.LockComponentRelativeRotation = OffsetRotation * FootState.LockComponentRelativeRotation;
-		FootState.LockComponentRelativeRotation.Normalize();
+	const auto ConstrainedLockAngle{FMath::Clamp(LockAngle, -Settings->Feet.FootLockAngleLimit, Settings->Feet.FootLockAngleLimit)};
+	const FQuat4f OffsetRotation{FVector3f::ZAxisVector, FMath::DegreesToRadians(ConstrainedLockAngle - LockAngle)};
 
-		const auto& ComponentTransform{GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform()};
+	FootState.LockComponentRelativeLocation = OffsetRotation.RotateVector(FootState.LockComponentRelativeLocation);
+	FootState.LockComponentRelativeRotation = OffsetRotation * FootState.LockComponentRelativeRotation;
+	FootState.LockComponentRelativeRotation.Normalize();
 
-		FootState.LockLocation = ComponentTransform.TransformPosition(FVector{FootState.LockComponentRelativeLocation});
-		FootState.LockRotation = ComponentTransform.TransformRotation(FQuat{FootState.LockComponentRelativeRotation});
+	FootState.LockLocation = Context.ComponentTransform.TransformPosition(FVector{FootState.LockComponentRelativeLocation});
+	FootState.LockRotation = Context.ComponentTransform.TransformRotation(FQuat{FootState.LockComponentRelativeRotation});
 
-		if (MovementBase.bHasRelativeLocation)
-		{
-			const auto BaseRotationInverse{MovementBase.Rotation.Inverse()};
+	if (MovementBase.bHasRelativeLocation)
+	{
+		const auto& BaseRotationInverse{Context.MovementBaseRotationInverse};
 
-			FootState.LockMovementBaseRelativeLocation =
-				FVector3f{BaseRotationInverse.RotateVector(FootState.LockLocation - MovementBase.Location)};
+		FootState.LockMovementBaseRelativeLocation =
+			FVector3f{BaseRotationInverse.RotateVector(FootState.LockLocation - MovementBase.Location)};
 
-			FootState.LockMovementBaseRelativeRotation = FQuat4f{BaseRotationInverse * FootState.LockRotation};
-		}
+		FootState.LockMovementBaseRelativeRotation = FQuat4f{BaseRotationInverse * FootState.LockRotation};
 	}
 
-	const auto FinalLocation{FMath::Lerp(FootState.TargetLocation, FootState.LockLocation, FootState.LockAmount)};
-
-	auto FinalRotation{FQuat::FastLerp(FootState.TargetRotation, FootState.LockRotation, FootState.LockAmount)};
-	FinalRotation.Normalize();
-
-	FootState.FinalLocation = FVector3f{Context.ComponentTransformInverse.TransformPosition(FinalLocation)};
-	FootState.FinalRotation = FQuat4f{Context.ComponentTransformInverse.TransformRotation(FinalRotation)};
+	return true;
 }
 
 void UAlsAnimationInstance::PlayQuickStopAnimation()
@@ -1512,7 +1722,8 @@ void UAlsAnimationInstance::RefreshTransitions()
 {
 	// The allow transitions curve is modified within certain states, so that transitions allowed will be true while in those states.
 
-	TransitionsState.bTransitionsAllowed = FAnimWeight::IsFullWeight(GetCurveValue(UAlsConstants::AllowTransitionsCurveName()));
+	TransitionsState.bTransitionsAllowed = !LodState.bTransitionsDisabled &&
+	                                       FAnimWeight::IsFullWeight(GetCurveValue(UAlsConstants::AllowTransitionsCurveName()));
 }
 
 void UAlsAnimationInstance::RefreshDynamicTransitions()
@@ -1528,7 +1739,7 @@ void UAlsAnimationInstance::RefreshDynamicTransitions()
 	                            STAT_UAlsAnimationInstance_RefreshDynamicTransitions, STATGROUP_Als)
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
 
-	if (DynamicTransitionsState.bUpdatedThisFrame || !IsValid(Settings))
+	if (DynamicTransitionsState.bUpdatedThisFrame || !IsValid(Settings) || LodState.bDynamicTransitionsDisabled)
 	{
 		return;
 	}
@@ -1617,9 +1828,10 @@ void UAlsAnimationInstance::PlayQueuedTransitionAnimation()
 		return;
 	}
 
-	PlaySlotAnimationAsDynamicMontage(TransitionsState.QueuedTransitionSequence, UAlsConstants::TransitionSlotName(),
-	                                  TransitionsState.QueuedTransitionBlendInDuration, TransitionsState.QueuedTransitionBlendOutDuration,
-	                                  TransitionsState.QueuedTransitionPlayRate, 1, 0.0f, TransitionsState.QueuedTransitionStartTime);
+	PlaySlotAnimationAsCachedDynamicMontage(TransitionsState.QueuedTransitionSequence, UAlsConstants::TransitionSlotName(),
+	                                        TransitionsState.QueuedTransitionBlendInDuration,
+	                                        TransitionsState.QueuedTransitionBlendOutDuration,
+	                                        TransitionsState.QueuedTransitionPlayRate, TransitionsState.QueuedTransitionStartTime);
 
 	TransitionsState.QueuedTransitionSequence = nullptr;
 	TransitionsState.QueuedTransitionBlendInDuration = 0.0f;
@@ -1645,6 +1857,56 @@ void UAlsAnimationInstance::StopQueuedTransitionAndTurnInPlaceAnimations()
 	TransitionsState.QueuedStopTransitionsBlendOutDuration = 0.0f;
 }
 
+UAnimMontage* UAlsAnimationInstance::PlaySlotAnimationAsCachedDynamicMontage(UAnimSequenceBase* Sequence, const FName& SlotName,
+                                                                             const float BlendInDuration, const float BlendOutDuration,
+                                                                             const float PlayRate, const float StartTime)
+{
+	check(IsInGameThread())
+
+	// Same as UAnimInstance::PlaySlotAnimationAsDynamicMontage(), but reuses previously created montages
+	// instead of creating a new one on each call, which reduces the number of objects the garbage collector has to process.
+
+	if (!IsValid(Sequence) || Sequence->IsA<UAnimMontage>())
+	{
+		return nullptr;
+	}
+
+	auto* CacheEntry{
+		DynamicMontagesCache.FindByPredicate([Sequence, &SlotName, BlendInDuration, BlendOutDuration](const FAlsDynamicMontageCacheEntry& Entry)
+		{
+			return Entry.Sequence == Sequence && Entry.SlotName == SlotName &&
+			       Entry.BlendInDuration == BlendInDuration && Entry.BlendOutDuration == BlendOutDuration;
+		})
+	};
+
+	if (CacheEntry == nullptr || !IsValid(CacheEntry->Montage))
+	{
+		auto* Montage{
+			UAnimMontage::CreateSlotAnimationAsDynamicMontage(Sequence, SlotName, BlendInDuration, BlendOutDuration, 1.0f, 1, 0.0f)
+		};
+
+		if (!IsValid(Montage))
+		{
+			return nullptr;
+		}
+
+		if (CacheEntry == nullptr)
+		{
+			CacheEntry = &DynamicMontagesCache.Emplace_GetRef();
+			CacheEntry->Sequence = Sequence;
+			CacheEntry->SlotName = SlotName;
+			CacheEntry->BlendInDuration = BlendInDuration;
+			CacheEntry->BlendOutDuration = BlendOutDuration;
+		}
+
+		CacheEntry->Montage = Montage;
+	}
+
+	return Montage_Play(CacheEntry->Montage, PlayRate, EMontagePlayReturnType::MontageLength, StartTime) > 0.0f
+		       ? CacheEntry->Montage.Get()
+		       : nullptr;
+}
+
 bool UAlsAnimationInstance::IsRotateInPlaceAllowed()
 {
 	return RotationMode == AlsRotationModeTags::Aiming || ViewMode == AlsViewModeTags::FirstPerson;
@@ -1670,7 +1932,7 @@ void UAlsAnimationInstance::RefreshRotateInPlace()
 
 	RotateInPlaceState.bUpdatedThisFrame = true;
 
-	if (LocomotionState.bMoving || !IsRotateInPlaceAllowed())
+	if (LocomotionState.bMoving || LodState.bRotateInPlaceDisabled || !IsRotateInPlaceAllowed())
 	{
 		RotateInPlaceState.bRotatingLeft = false;
 		RotateInPlaceState.bRotatingRight = false;
@@ -1738,7 +2000,7 @@ void UAlsAnimationInstance::RefreshTurnInPlace()
 
 	TurnInPlaceState.bUpdatedThisFrame = true;
 
-	if (!TransitionsState.bTransitionsAllowed || !IsTurnInPlaceAllowed())
+	if (!TransitionsState.bTransitionsAllowed || LodState.bTurnInPlaceDisabled || !IsTurnInPlaceAllowed())
 	{
 		TurnInPlaceState.ActivationDelay = 0.0f;
 		return;
@@ -1838,9 +2100,9 @@ void UAlsAnimationInstance::PlayQueuedTurnInPlaceAnimation()
 
 	const auto* TurnInPlaceSettings{TurnInPlaceState.QueuedSettings.Get()};
 
-	PlaySlotAnimationAsDynamicMontage(TurnInPlaceSettings->Sequence, TurnInPlaceState.QueuedSlotName,
-	                                  Settings->TurnInPlace.BlendDuration, Settings->TurnInPlace.BlendDuration,
-	                                  TurnInPlaceSettings->PlayRate, 1, 0.0f);
+	PlaySlotAnimationAsCachedDynamicMontage(TurnInPlaceSettings->Sequence, TurnInPlaceState.QueuedSlotName,
+	                                        Settings->TurnInPlace.BlendDuration, Settings->TurnInPlace.BlendDuration,
+	                                        TurnInPlaceSettings->PlayRate);
 
 	// Scale the rotation yaw delta (gets scaled in animation graph) to compensate for play rate and turn angle (if allowed).
 
@@ -1869,18 +2131,174 @@ void UAlsAnimationInstance::RefreshRagdollingOnGameThread()
 
 	static constexpr auto ReferenceSpeed{1000.0f};
 
-	RagdollingState.FlailPlayRate = UAlsMath::Clamp01(UE_REAL_TO_FLOAT(Character->GetRagdollingState().Velocity.Size() / ReferenceSpeed));
+	RagdollingState.FlailPlayRate = UAlsMath::Clamp01(CharacterSnapshot.RagdollingSpeed / ReferenceSpeed);
 }
 
-FPoseSnapshot& UAlsAnimationInstance::SnapshotFinalRagdollPose()
+FPoseSnapshot& UAlsAnimationInstance::SnapshotFinalRagdollPose(const bool bSimulatedBonesOnly)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::SnapshotFinalRagdollPose"),
+	                            STAT_UAlsAnimationInstance_SnapshotFinalRagdollPose, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	check(IsInGameThread())
 
 	// Save a snapshot of the current ragdoll pose for use in animation graph to blend out of the ragdoll.
 
-	SnapshotPose(RagdollingState.FinalRagdollPose);
+	auto& FinalRagdollPose{RagdollingState.FinalRagdollPose};
+
+	if (!BindFinalRagdollPose())
+	{
+		SnapshotPose(FinalRagdollPose);
+		return FinalRagdollPose;
+	}
+
+	const auto* Mesh{GetSkelMeshComponent()};
+	const auto& ComponentSpaceTransforms{Mesh->GetComponentSpaceTransforms()};
+
+	// At higher LODs, some bones are not evaluated and their component space transforms are not up to date, so in this case the
+	// full snapshot is left to the engine, which replaces such bones with the reference pose, but still reuses the bound buffer.
+
+	if (ComponentSpaceTransforms.Num() != FinalRagdollPose.LocalTransforms.Num() ||
+	    (!bSimulatedBonesOnly && Mesh->GetPredictedLODLevel() > 0))
+	{
+		SnapshotPose(FinalRagdollPose);
+		return FinalRagdollPose;
+	}
+
+	FinalRagdollPose.LocalTransforms[0] = ComponentSpaceTransforms[0];
+
+	if (bSimulatedBonesOnly)
+	{
+		// Reset all non-simulated bones to the reference pose, since they may still hold the transforms of a previous full snapshot.
+
+		const auto& ReferencePose{Mesh->GetSkinnedAsset()->GetRefSkeleton().GetRefBonePose()};
+
+		for (auto BoneIndex{1}; BoneIndex < ComponentSpaceTransforms.Num(); BoneIndex++)
+		{
+			FinalRagdollPose.LocalTransforms[BoneIndex] = ReferencePose[BoneIndex];
+		}
+
+		// Bones with physics bodies are always evaluated, regardless of the LOD. Since the bones between a simulated bone and
+		// its nearest simulated ancestor are in the reference pose, the parent transform is reconstructed from that ancestor.
+
+		const auto& SimulatedBoneIndices{RagdollingState.FinalRagdollPoseSimulatedBoneIndices};
+
+		for (auto i{0}; i < SimulatedBoneIndices.Num(); i++)
+		{
+			const auto BoneIndex{SimulatedBoneIndices[i]};
+
+			const auto ParentTransform{
+				RagdollingState.FinalRagdollPoseSimulatedParentOffsets[i] *
+				ComponentSpaceTransforms[RagdollingState.FinalRagdollPoseSimulatedAncestorBoneIndices[i]]
+			};
+
+			FinalRagdollPose.LocalTransforms[BoneIndex] = ComponentSpaceTransforms[BoneIndex].GetRelativeTransform(ParentTransform);
+		}
+	}
+	else
+	{
+		for (auto BoneIndex{1}; BoneIndex < ComponentSpaceTransforms.Num(); BoneIndex++)
+		{
+			FinalRagdollPose.LocalTransforms[BoneIndex] = ComponentSpaceTransforms[BoneIndex].GetRelativeTransform(
+				ComponentSpaceTransforms[RagdollingState.FinalRagdollPoseParentBoneIndices[BoneIndex]]);
+		}
+	}
+
+	FinalRagdollPose.bIsValid = true;
+
+	return FinalRagdollPose;
+}
+
+bool UAlsAnimationInstance::BindFinalRagdollPose()
+{
+	const auto* Mesh{GetSkelMeshComponent()};
+	const auto* SkinnedAsset{Mesh->GetSkinnedAsset()};
+	const auto* PhysicsAsset{Mesh->GetPhysicsAsset()};
+
+	if (!IsValid(SkinnedAsset))
+	{
+		RagdollingState.FinalRagdollPoseSkinnedAsset.Reset();
+		RagdollingState.FinalRagdollPosePelvisBoneIndex = INDEX_NONE;
+		return false;
+	}
+
+	if (RagdollingState.FinalRagdollPoseSkinnedAsset == SkinnedAsset &&
+	    RagdollingState.FinalRagdollPosePhysicsAsset == PhysicsAsset)
+	{
+		return true;
+	}
+
+	// Bone names, parent indices and the reference pose are resolved only once per skinned asset, so that subsequent
+	// snapshots do not need to allocate memory or look up bones by name and can simply copy the bone transforms.
+
+	const auto& ReferenceSkeleton{SkinnedAsset->GetRefSkeleton()};
+	const auto BonesCount{ReferenceSkeleton.GetNum()};
+
+	auto& FinalRagdollPose{RagdollingState.FinalRagdollPose};
+
+	FinalRagdollPose.SkeletalMeshName = SkinnedAsset->GetFName();
+	FinalRagdollPose.LocalTransforms = ReferenceSkeleton.GetRefBonePose();
+	FinalRagdollPose.BoneNames.Reset(BonesCount);
+	FinalRagdollPose.bIsValid = false;
+
+	RagdollingState.FinalRagdollPoseParentBoneIndices.Reset(BonesCount);
+
+	for (auto BoneIndex{0}; BoneIndex < BonesCount; BoneIndex++)
+	{
+		FinalRagdollPose.BoneNames.Add(ReferenceSkeleton.GetBoneName(BoneIndex));
+		RagdollingState.FinalRagdollPoseParentBoneIndices.Add(FMath::Max(0, ReferenceSkeleton.GetParentIndex(BoneIndex)));
+	}
+
+	RagdollingState.FinalRagdollPoseSimulatedBoneIndices.Reset();
+
+	if (IsValid(PhysicsAsset))
+	{
+		for (const auto& BodySetup : PhysicsAsset->SkeletalBodySetups)
+		{
+			const auto BoneIndex{IsValid(BodySetup) ? ReferenceSkeleton.FindBoneIndex(BodySetup->BoneName) : INDEX_NONE};
+			if (BoneIndex > 0)
+			{
+				RagdollingState.FinalRagdollPoseSimulatedBoneIndices.AddUnique(BoneIndex);
+			}
+		}
+
+		RagdollingState.FinalRagdollPoseSimulatedBoneIndices.Sort();
+	}
+
+	const auto& SimulatedBoneIndices{RagdollingState.FinalRagdollPoseSimulatedBoneIndices};
+	const auto& ReferencePose{ReferenceSkeleton.GetRefBonePose()};
+
+	TBitArray<> SimulatedBones{false, BonesCount};
+
+	for (const auto BoneIndex : SimulatedBoneIndices)
+	{
+		SimulatedBones[BoneIndex] = true;
+	}
+
+	RagdollingState.FinalRagdollPoseSimulatedAncestorBoneIndices.Reset(SimulatedBoneIndices.Num());
+	RagdollingState.FinalRagdollPoseSimulatedParentOffsets.Reset(SimulatedBoneIndices.Num());
+
+	for (const auto BoneIndex : SimulatedBoneIndices)
+	{
+		auto AncestorBoneIndex{RagdollingState.FinalRagdollPoseParentBoneIndices[BoneIndex]};
+		auto ParentOffset{FTransform::Identity};
+
+		while (AncestorBoneIndex > 0 && !SimulatedBones[AncestorBoneIndex])
+		{
+			ParentOffset *= ReferencePose[AncestorBoneIndex];
+			AncestorBoneIndex = RagdollingState.FinalRagdollPoseParentBoneIndices[AncestorBoneIndex];
+		}
+
+		RagdollingState.FinalRagdollPoseSimulatedAncestorBoneIndices.Add(AncestorBoneIndex);
+		RagdollingState.FinalRagdollPoseSimulatedParentOffsets.Add(ParentOffset);
+	}
+
+	RagdollingState.FinalRagdollPosePelvisBoneIndex = ReferenceSkeleton.FindBoneIndex(UAlsConstants::PelvisBoneName());
+
+	RagdollingState.FinalRagdollPoseSkinnedAsset = SkinnedAsset;
+	RagdollingState.FinalRagdollPosePhysicsAsset = PhysicsAsset;
 
-	return RagdollingState.FinalRagdollPose;
+	return true;
 }
 
 float UAlsAnimationInstance::GetCurveValueClamped01(const FName& CurveName) const
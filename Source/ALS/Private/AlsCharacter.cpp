@@ -2,6 +2,7 @@
 
 #include "AlsAnimationInstance.h"
 #include "AlsCharacterMovementComponent.h"
+#include "AlsSkeletalMeshComponent.h"
 #include "TimerManager.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
@@ -10,6 +11,7 @@
 #include "GameFramework/PlayerController.h"
 #include "Net/UnrealNetwork.h"
 #include "Net/Core/PushModel/PushModel.h"
+#include "Settings/AlsAnimationInstanceSettings.h"
 #include "Settings/AlsCharacterSettings.h"
 #include "Utility/AlsConstants.h"
 #include "Utility/AlsMacros.h"
@@ -26,6 +28,7 @@ namespace AlsCharacter
 
 AAlsCharacter::AAlsCharacter(const FObjectInitializer& ObjectInitializer) : Super{
 	ObjectInitializer.SetDefaultSubobjectClass<UAlsCharacterMovementComponent>(CharacterMovementComponentName)
+	                 .SetDefaultSubobjectClass<UAlsSkeletalMeshComponent>(MeshComponentName)
 }
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -91,6 +94,7 @@ void AAlsCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLif
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ReplicatedViewRotation, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, InputDirection, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, DesiredVelocityYawAngle, Parameters)
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, InitialVelocityYawAngle, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, RagdollTargetLocation, Parameters)
 }
 
@@ -305,9 +309,13 @@ void AAlsCharacter::Tick(const float DeltaTime)
 	RefreshRagdolling(DeltaTime);
 	RefreshRolling(DeltaTime);
 
+	RefreshNetUpdateFrequency(DeltaTime);
+
 	Super::Tick(DeltaTime);
 
 	RefreshLocomotionLate();
+
+	RefreshSnapshot();
 }
 
 void AAlsCharacter::PossessedBy(AController* NewController)
@@ -329,6 +337,27 @@ void AAlsCharacter::Restart()
 	ApplyDesiredStance();
 }
 
+void AAlsCharacter::SetAnimationInstanceClass(const TSubclassOf<UAlsAnimationInstance> NewAnimationInstanceClass)
+{
+	if (!ALS_ENSURE(IsValid(NewAnimationInstanceClass)) || GetMesh()->GetAnimClass() == NewAnimationInstanceClass)
+	{
+		return;
+	}
+
+	// The previous animation instance is not destroyed immediately, so its state can still be copied.
+
+	const auto* PreviousAnimationInstance{AnimationInstance.Get()};
+
+	GetMesh()->SetAnimInstanceClass(NewAnimationInstanceClass);
+
+	AnimationInstance = Cast<UAlsAnimationInstance>(GetMesh()->GetAnimInstance());
+
+	if (AnimationInstance.IsValid() && IsValid(PreviousAnimationInstance))
+	{
+		AnimationInstance->CopyStateFrom(PreviousAnimationInstance);
+	}
+}
+
 bool AAlsCharacter::OnCalculateCamera_Implementation(float DeltaTime, FMinimalViewInfo& ViewInfo)
 {
 	return false;
@@ -357,14 +386,27 @@ void AAlsCharacter::RefreshMeshProperties() const
 
 	// Keep the default tick option, at least if the target tick option is not required by the plugin to work properly.
 
-	GetMesh()->VisibilityBasedAnimTickOption = FMath::Min(TargetTickOption, DefaultTickOption);
+	auto TickOption{FMath::Min(TargetTickOption, DefaultTickOption)};
+
+	// When the animation instance only updates the gameplay state on the dedicated server, nothing there needs the evaluated
+	// pose, so bones are never refreshed, even if the default tick option says otherwise. The only exception is ragdolling.
+
+	const auto* AnimationSettings{AnimationInstance.IsValid() ? AnimationInstance->GetSettingsUnsafe() : nullptr};
+
+	if (bDedicatedServer && IsValid(AnimationSettings) && AnimationSettings->General.bGameplayOnlyUpdateOnDedicatedServer &&
+	    LocomotionAction != AlsLocomotionActionTags::Ragdolling)
+	{
+		TickOption = FMath::Max(TickOption, EVisibilityBasedAnimTickOption::AlwaysTickPose);
+	}
+
+	GetMesh()->VisibilityBasedAnimTickOption = TickOption;
 
 	const auto bMeshIsTicking{
 		GetMesh()->bRecentlyRendered || GetMesh()->VisibilityBasedAnimTickOption <= EVisibilityBasedAnimTickOption::AlwaysTickPose
 	};
 
 	// Use absolute mesh rotation to be able to precisely synchronize character rotation
-	// with animations by manually updating the mesh rotation from the animation instance.
+	// with animations by manually updating the mesh rotation right before the animation update.
 
 	// This is necessary in cases where the character and the animation instance are ticking
 	// at different frequencies, which leads to desynchronization of rotation animations
@@ -382,9 +424,11 @@ void AAlsCharacter::RefreshMeshProperties() const
 
 	const auto bStandingOnRotatingObject{MovementBase.bHasRelativeRotation};
 
+	// The mesh rotation can only be synchronized by the ALS skeletal mesh component.
+
 	const auto bUseAbsoluteRotation{
 		bMeshIsTicking && !bDedicatedServer && !bLocallyControlled && !bStandingOnRotatingObject &&
-		(bUROActive || bAutonomousProxyOnListenServer)
+		(bUROActive || bAutonomousProxyOnListenServer) && GetMesh()->IsA<UAlsSkeletalMeshComponent>()
 	};
 
 	if (GetMesh()->IsUsingAbsoluteRotation() != bUseAbsoluteRotation)
@@ -516,6 +560,8 @@ void AAlsCharacter::NotifyLocomotionModeChanged(const FGameplayTag& PreviousLoco
 {
 	ApplyDesiredStance();
 
+	ForceNetUpdateOnStateChange();
+
 	if (LocomotionMode == AlsLocomotionModeTags::Grounded &&
 	    PreviousLocomotionMode == AlsLocomotionModeTags::InAir)
 	{
@@ -890,6 +936,8 @@ void AAlsCharacter::SetStance(const FGameplayTag& NewStance)
 
 		Stance = NewStance;
 
+		ForceNetUpdateOnStateChange();
+
 		OnStanceChanged(PreviousStance);
 	}
 }
@@ -943,6 +991,8 @@ void AAlsCharacter::SetGait(const FGameplayTag& NewGait)
 
 		Gait = NewGait;
 
+		ForceNetUpdateOnStateChange();
+
 		OnGaitChanged(PreviousGait);
 	}
 }
@@ -1107,6 +1157,8 @@ void AAlsCharacter::NotifyLocomotionActionChanged(const FGameplayTag& PreviousLo
 
 	ApplyDesiredStance();
 
+	ForceNetUpdateOnStateChange();
+
 	OnLocomotionActionChanged(PreviousLocomotionAction);
 }
 
@@ -1429,7 +1481,18 @@ void AAlsCharacter::RefreshLocomotion()
 		     GetRemoteRole() == ROLE_SimulatedProxy ||
 		     (IsNetMode(NM_ListenServer) && IsLocallyControlled())))
 		{
-			ServerSetInitialVelocityYawAngle(VelocityYawAngleToSend);
+			if (!Settings->bSendInitialVelocityYawAngleWithMoveData)
+			{
+				ServerSetInitialVelocityYawAngle(VelocityYawAngleToSend);
+			}
+			else if (GetLocalRole() == ROLE_AutonomousProxy)
+			{
+				AlsCharacterMovement->SetPendingInitialVelocityYawAngle(VelocityYawAngleToSend);
+			}
+			else
+			{
+				SetInitialVelocityYawAngle(VelocityYawAngleToSend);
+			}
 		}
 	}
 
@@ -1455,6 +1518,26 @@ void AAlsCharacter::ServerSetInitialVelocityYawAngle_Implementation(const float
 }
 
 void AAlsCharacter::MulticastSetInitialVelocityYawAngle_Implementation(const float NewVelocityYawAngle)
+{
+	ApplyInitialVelocityYawAngle(NewVelocityYawAngle);
+}
+
+void AAlsCharacter::SetInitialVelocityYawAngle(const float NewVelocityYawAngle)
+{
+	ApplyInitialVelocityYawAngle(NewVelocityYawAngle);
+
+	InitialVelocityYawAngle.YawAngle = NewVelocityYawAngle;
+	InitialVelocityYawAngle.Counter += 1;
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, InitialVelocityYawAngle, this)
+}
+
+void AAlsCharacter::OnReplicated_InitialVelocityYawAngle()
+{
+	ApplyInitialVelocityYawAngle(InitialVelocityYawAngle.YawAngle);
+}
+
+void AAlsCharacter::ApplyInitialVelocityYawAngle(const float NewVelocityYawAngle)
 {
 	if (GetLocalRole() != ROLE_AutonomousProxy)
 	{
@@ -1944,3 +2027,66 @@ void AAlsCharacter::RefreshViewRelativeTargetYawAngle()
 	LocomotionState.ViewRelativeTargetYawAngle = FMath::UnwindDegrees(UE_REAL_TO_FLOAT(
 		ViewState.Rotation.Yaw - LocomotionState.TargetYawAngle));
 }
+
+void AAlsCharacter::RefreshSnapshot()
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::RefreshSnapshot"), STAT_AAlsCharacter_RefreshSnapshot, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	Snapshot.FrameNumber = GFrameCounter;
+
+	Snapshot.ViewMode = ViewMode;
+	Snapshot.LocomotionMode = LocomotionMode;
+	Snapshot.RotationMode = RotationMode;
+	Snapshot.Stance = Stance;
+	Snapshot.Gait = Gait;
+	Snapshot.OverlayMode = OverlayMode;
+	Snapshot.LocomotionAction = LocomotionAction;
+
+	Snapshot.MovementBasePrimitive = BasedMovement.MovementBase;
+	Snapshot.MovementBaseBoneName = BasedMovement.BoneName;
+	Snapshot.bMovementBaseHasRelativeLocation = BasedMovement.HasRelativeLocation();
+	Snapshot.bMovementBaseHasRelativeRotation = Snapshot.bMovementBaseHasRelativeLocation && BasedMovement.bRelativeRotation;
+
+	MovementBaseUtility::GetMovementBaseTransform(BasedMovement.MovementBase, BasedMovement.BoneName,
+	                                              Snapshot.MovementBaseLocation, Snapshot.MovementBaseRotation);
+
+	Snapshot.ViewRotation = ViewState.Rotation;
+	Snapshot.ViewYawSpeed = ViewState.YawSpeed;
+
+	Snapshot.bHasInput = LocomotionState.bHasInput;
+	Snapshot.InputYawAngle = LocomotionState.InputYawAngle;
+	Snapshot.Speed = LocomotionState.Speed;
+	Snapshot.bHasVelocity = LocomotionState.bHasVelocity;
+	Snapshot.Velocity = LocomotionState.Velocity;
+	Snapshot.VelocityYawAngle = LocomotionState.VelocityYawAngle;
+	Snapshot.bMoving = LocomotionState.bMoving;
+	Snapshot.TargetYawAngle = LocomotionState.TargetYawAngle;
+
+	Snapshot.MaxAcceleration = AlsCharacterMovement->GetMaxAcceleration();
+	Snapshot.MaxBrakingDeceleration = AlsCharacterMovement->GetMaxBrakingDeceleration();
+	Snapshot.WalkableFloorAngleCos = AlsCharacterMovement->GetWalkableFloorZ();
+
+	static const auto* EnableListenServerSmoothingConsoleVariable{
+		IConsoleManager::Get().FindConsoleVariable(TEXT("p.NetEnableListenServerSmoothing"))
+	};
+	check(EnableListenServerSmoothingConsoleVariable != nullptr)
+
+	Snapshot.bNetworkSmoothingActive = AlsCharacterMovement->NetworkSmoothingMode != ENetworkSmoothingMode::Disabled &&
+	                                   (GetLocalRole() == ROLE_SimulatedProxy ||
+	                                    (IsNetMode(NM_ListenServer) && EnableListenServerSmoothingConsoleVariable->GetBool()));
+
+	Snapshot.BaseTranslationOffset = GetBaseTranslationOffset();
+	Snapshot.BaseRotationOffset = GetBaseRotationOffset();
+
+	const auto* Capsule{GetCapsuleComponent()};
+
+	Snapshot.CapsuleRadius = Capsule->GetScaledCapsuleRadius();
+	Snapshot.CapsuleHalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+
+	Snapshot.RagdollingSpeed = LocomotionAction == AlsLocomotionActionTags::Ragdolling
+		                           ? UE_REAL_TO_FLOAT(RagdollingState.Velocity.Size())
+		                           : 0.0f;
+
+	Snapshot.CustomTimeDilation = CustomTimeDilation;
+}
@@ -1,11 +1,13 @@
 #include "AlsCharacterMovementComponent.h"
 
 #include "AlsCharacter.h"
+#include "AlsSceneQuerySubsystem.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Curves/CurveVector.h"
 #include "Engine/World.h"
 #include "GameFramework/Controller.h"
+#include "ProfilingDebugging/CsvProfiler.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsRotation.h"
 #include "Utility/AlsUtility.h"
@@ -13,6 +15,12 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCharacterMovementComponent)
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Server Moves Processed"), STAT_AlsCharacterMovement_ServerMoves, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Server Corrections"), STAT_AlsCharacterMovement_ServerCorrections, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Saved Moves Combined"), STAT_AlsCharacterMovement_CombinedMoves, STATGROUP_Als)
+
+CSV_DECLARE_CATEGORY_EXTERN(AlsNetwork);
+
 void FAlsCharacterNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Character& Move, const ENetworkMoveType MoveType)
 {
 	Super::ClientFillNetworkMoveData(Move, MoveType);
@@ -22,6 +30,9 @@ void FAlsCharacterNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Ch
 	RotationMode = SavedMove.RotationMode;
 	Stance = SavedMove.Stance;
 	MaxAllowedGait = SavedMove.MaxAllowedGait;
+
+	bInitialVelocityYawAngleValid = SavedMove.bInitialVelocityYawAngleValid;
+	InitialVelocityYawAngle = SavedMove.InitialVelocityYawAngle;
 }
 
 bool FAlsCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& Movement, FArchive& Archive,
@@ -33,6 +44,18 @@ bool FAlsCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& Moveme
 	NetSerializeOptionalValue(Archive.IsSaving(), Archive, Stance, AlsStanceTags::Standing.GetTag(), Map);
 	NetSerializeOptionalValue(Archive.IsSaving(), Archive, MaxAllowedGait, AlsGaitTags::Running.GetTag(), Map);
 
+	uint8 bSerializeInitialVelocityYawAngle{bInitialVelocityYawAngleValid};
+	Archive.SerializeBits(&bSerializeInitialVelocityYawAngle, 1);
+	bInitialVelocityYawAngleValid = bSerializeInitialVelocityYawAngle;
+
+	if (bInitialVelocityYawAngleValid)
+	{
+		auto CompressedYawAngle{FRotator3f::CompressAxisToShort(InitialVelocityYawAngle)};
+		Archive << CompressedYawAngle;
+
+		InitialVelocityYawAngle = FMath::UnwindDegrees(FRotator3f::DecompressAxisFromShort(CompressedYawAngle));
+	}
+
 	return !Archive.IsError();
 }
 
@@ -50,6 +73,9 @@ void FAlsSavedMove::Clear()
 	RotationMode = AlsRotationModeTags::ViewDirection;
 	Stance = AlsStanceTags::Standing;
 	MaxAllowedGait = AlsGaitTags::Running;
+
+	bInitialVelocityYawAngleValid = false;
+	InitialVelocityYawAngle = 0.0f;
 }
 
 void FAlsSavedMove::SetMoveFor(ACharacter* Character, const float NewDeltaTime, const FVector& NewAcceleration,
@@ -57,12 +83,25 @@ void FAlsSavedMove::SetMoveFor(ACharacter* Character, const float NewDeltaTime,
 {
 	Super::SetMoveFor(Character, NewDeltaTime, NewAcceleration, PredictionData);
 
-	const auto* Movement{Cast<UAlsCharacterMovementComponent>(Character->GetCharacterMovement())};
+	auto* Movement{Cast<UAlsCharacterMovementComponent>(Character->GetCharacterMovement())};
 	if (IsValid(Movement))
 	{
 		RotationMode = Movement->RotationMode;
 		Stance = Movement->Stance;
 		MaxAllowedGait = Movement->MaxAllowedGait;
+
+		bInitialVelocityYawAngleValid = Movement->bPendingInitialVelocityYawAngleValid;
+		InitialVelocityYawAngle = Movement->PendingInitialVelocityYawAngle;
+
+#if WITH_DEV_AUTOMATION_TESTS
+		if (bInitialVelocityYawAngleValid)
+		{
+			Movement->NetworkCounters.SentInitialVelocityYawAnglesCount += 1;
+			Movement->NetworkCounters.LastSentInitialVelocityYawAngle = InitialVelocityYawAngle;
+		}
+#endif
+
+		Movement->bPendingInitialVelocityYawAngleValid = false;
 	}
 }
 
@@ -70,12 +109,23 @@ bool FAlsSavedMove::CanCombineWith(const FSavedMovePtr& NewMovePtr, ACharacter*
 {
 	const auto* NewMove{static_cast<FAlsSavedMove*>(NewMovePtr.Get())}; // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
 
-	return RotationMode == NewMove->RotationMode &&
+	// Moves that carry the initial velocity yaw angle are never combined so that the angle is not lost.
+
+	return !bInitialVelocityYawAngleValid && !NewMove->bInitialVelocityYawAngleValid &&
+	       RotationMode == NewMove->RotationMode &&
 	       Stance == NewMove->Stance &&
 	       MaxAllowedGait == NewMove->MaxAllowedGait &&
 	       Super::CanCombineWith(NewMovePtr, Character, MaxDeltaTime);
 }
 
+bool FAlsSavedMove::IsImportantMove(const FSavedMovePtr& LastAckedMove) const
+{
+	// The initial velocity yaw angle is sent only once, so the move that carries it must
+	// be resent as an old move until it is acknowledged, in case its packet was lost.
+
+	return bInitialVelocityYawAngleValid || Super::IsImportantMove(LastAckedMove);
+}
+
 void FAlsSavedMove::CombineWith(const FSavedMove_Character* PreviousMove, ACharacter* Character,
                                 APlayerController* Player, const FVector& PreviousStartLocation)
 {
@@ -83,6 +133,17 @@ void FAlsSavedMove::CombineWith(const FSavedMove_Character* PreviousMove, AChara
 	// undesirable because it will erase our rotation changes made in the AAlsCharacter class. So, to keep the rotation unchanged,
 	// we simply override the saved rotations with the current rotation, and after calling Super::CombineWith() we restore them.
 
+	INC_DWORD_STAT(STAT_AlsCharacterMovement_CombinedMoves)
+	CSV_CUSTOM_STAT(AlsNetwork, SavedMovesCombined, 1, ECsvCustomStatOp::Accumulate);
+
+#if WITH_DEV_AUTOMATION_TESTS
+	auto* Movement{Cast<UAlsCharacterMovementComponent>(Character->GetCharacterMovement())};
+	if (IsValid(Movement))
+	{
+		Movement->NetworkCounters.CombinedMovesCount += 1;
+	}
+#endif
+
 	const auto OriginalRotation{PreviousMove->StartRotation};
 	const auto OriginalRelativeRotation{PreviousMove->StartAttachRelativeRotation};
 
@@ -692,6 +753,9 @@ void UAlsCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleLoca
 		float TraceDist = SweepDistance + ShrinkHeight;
 		FCollisionShape CapsuleShape = FCollisionShape::MakeCapsule(SweepRadius, PawnHalfHeight - ShrinkHeight);
 
+		// Floor queries cannot be deferred without breaking the movement, so they are only recorded.
+		UAlsSceneQuerySubsystem::RecordQueriesInWorld(GetWorld(), EAlsSceneQueryCategory::Floor);
+
 		FHitResult Hit(1.f);
 		bBlockingHit = FloorSweepTest(Hit, CapsuleLocation, CapsuleLocation + TraceDist * GetGravityDirection(), CollisionChannel, CapsuleShape, QueryParams, ResponseParam);
 
@@ -711,6 +775,7 @@ void UAlsCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleLoca
 					CapsuleShape.Capsule.HalfHeight = FMath::Max(PawnHalfHeight - ShrinkHeight, CapsuleShape.Capsule.Radius);
 					Hit.Reset(1.f, false);
 
+					UAlsSceneQuerySubsystem::RecordQueriesInWorld(GetWorld(), EAlsSceneQueryCategory::Floor);
 					bBlockingHit = FloorSweepTest(Hit, CapsuleLocation, CapsuleLocation + TraceDist * GetGravityDirection(), CollisionChannel, CapsuleShape, QueryParams, ResponseParam);
 				}
 			}
@@ -750,6 +815,8 @@ void UAlsCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleLoca
 		const FVector Down = TraceDist * GetGravityDirection();
 		QueryParams.TraceTag = SCENE_QUERY_STAT_NAME_ONLY(FloorLineTrace);
 
+		UAlsSceneQuerySubsystem::RecordQueriesInWorld(GetWorld(), EAlsSceneQueryCategory::Floor);
+
 		FHitResult Hit(1.f);
 		bBlockingHit = GetWorld()->LineTraceSingleByChannel(Hit, LineTraceStart, LineTraceStart + Down, CollisionChannel, QueryParams, ResponseParam);
 
@@ -836,7 +903,7 @@ void UAlsCharacterMovementComponent::SmoothClientPosition(const float DeltaTime)
 	if (PredictionData != nullptr && IsValid(Mesh) && Mesh->IsUsingAbsoluteRotation())
 	{
 		// Calling Super::SmoothClientPosition() will change the mesh's rotation, which is undesirable when using
-		// absolute mesh rotation since we're manually updating the mesh's rotation from the animation instance. So,
+		// absolute mesh rotation since we're manually updating the mesh's rotation in UAlsSkeletalMeshComponent. So,
 		// to keep the rotation unchanged, we simply override the predicted rotations with the mesh's current rotation.
 
 		const auto NewRotation{Mesh->GetComponentQuat() * CharacterOwner->GetBaseRotationOffset().Inverse()};
@@ -852,6 +919,19 @@ void UAlsCharacterMovementComponent::SmoothClientPosition(const float DeltaTime)
 void UAlsCharacterMovementComponent::MoveAutonomous(const float ClientTimeStamp, const float DeltaTime,
                                                     const uint8 CompressedFlags, const FVector& NewAcceleration)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCharacterMovementComponent::MoveAutonomous"),
+	                            STAT_UAlsCharacterMovementComponent_MoveAutonomous, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	INC_DWORD_STAT(STAT_AlsCharacterMovement_ServerMoves)
+	CSV_CUSTOM_STAT(AlsNetwork, ServerMovesProcessed, 1, ECsvCustomStatOp::Accumulate);
+
+#if WITH_DEV_AUTOMATION_TESTS
+	const auto StartCycles{FPlatformTime::Cycles64()};
+
+	NetworkCounters.ServerMovesCount += 1;
+#endif
+
 	const auto* MoveData{static_cast<FAlsCharacterNetworkMoveData*>(GetCurrentNetworkMoveData())}; // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
 	if (MoveData != nullptr)
 	{
@@ -860,6 +940,20 @@ void UAlsCharacterMovementComponent::MoveAutonomous(const float ClientTimeStamp,
 		MaxAllowedGait = MoveData->MaxAllowedGait;
 
 		RefreshGaitSettings();
+
+		if (MoveData->bInitialVelocityYawAngleValid)
+		{
+#if WITH_DEV_AUTOMATION_TESTS
+			NetworkCounters.ReceivedInitialVelocityYawAnglesCount += 1;
+			NetworkCounters.LastReceivedInitialVelocityYawAngle = MoveData->InitialVelocityYawAngle;
+#endif
+
+			auto* Character{Cast<AAlsCharacter>(CharacterOwner)};
+			if (IsValid(Character))
+			{
+				Character->SetInitialVelocityYawAngle(MoveData->InitialVelocityYawAngle);
+			}
+		}
 	}
 
 	Super::MoveAutonomous(ClientTimeStamp, DeltaTime, CompressedFlags, NewAcceleration);
@@ -880,6 +974,33 @@ void UAlsCharacterMovementComponent::MoveAutonomous(const float ClientTimeStamp,
 
 		PreviousControlRotation = NewControlRotation;
 	}
+
+#if WITH_DEV_AUTOMATION_TESTS
+	NetworkCounters.ServerMovesCycles += FPlatformTime::Cycles64() - StartCycles;
+#endif
+}
+
+bool UAlsCharacterMovementComponent::ServerCheckClientError(const float ClientTimeStamp, const float DeltaTime, const FVector& Acceleration,
+                                                            const FVector& ClientLocation, const FVector& RelativeClientLocation,
+                                                            UPrimitiveComponent* ClientMovementBase, const FName ClientBaseBoneName,
+                                                            const uint8 ClientMovementMode)
+{
+	const auto bError{
+		Super::ServerCheckClientError(ClientTimeStamp, DeltaTime, Acceleration, ClientLocation, RelativeClientLocation,
+		                              ClientMovementBase, ClientBaseBoneName, ClientMovementMode)
+	};
+
+	if (bError)
+	{
+		INC_DWORD_STAT(STAT_AlsCharacterMovement_ServerCorrections)
+		CSV_CUSTOM_STAT(AlsNetwork, ServerCorrections, 1, ECsvCustomStatOp::Accumulate);
+
+#if WITH_DEV_AUTOMATION_TESTS
+		NetworkCounters.ServerCorrectionsCount += 1;
+#endif
+	}
+
+	return bError;
 }
 
 void UAlsCharacterMovementComponent::SetMovementSettings(UAlsMovementSettings* NewMovementSettings)
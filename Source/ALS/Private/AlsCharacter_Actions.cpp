@@ -2,6 +2,8 @@
 
 #include "AlsAnimationInstance.h"
 #include "AlsCharacterMovementComponent.h"
+#include "AlsMantlingLedgeSubsystem.h"
+#include "AlsSceneQuerySubsystem.h"
 #include "DrawDebugHelpers.h"
 #include "TimerManager.h"
 #include "Components/CapsuleComponent.h"
@@ -205,6 +207,59 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 
 	const auto LedgeHeightDelta{UE_REAL_TO_FLOAT((TraceSettings.LedgeHeight.GetMax() - TraceSettings.LedgeHeight.GetMin()) * CapsuleScale)};
 
+	// In-air mantling is attempted every frame, so use the baked ledges to perform the traces less often when there
+	// is nothing to mantle on nearby. The baked ledges can only confirm that a ledge exists, since the bake can miss
+	// thin or movable geometry, so the traces are still performed periodically to catch such ledges.
+
+	if (Settings->Mantling.bUseBakedLedges && LocomotionMode == AlsLocomotionModeTags::InAir)
+	{
+		const auto* LedgeSubsystem{GetWorld()->GetSubsystem<UAlsMantlingLedgeSubsystem>()};
+
+		if (IsValid(LedgeSubsystem) && LedgeSubsystem->HasIndices())
+		{
+			const auto LedgeSearchRadius{
+				CapsuleRadius + (TraceSettings.ReachDistance + TraceSettings.TargetLocationOffset + 1.0f) * CapsuleScale
+			};
+
+			const FVector2f LedgeSearchHeight{
+				TraceSettings.LedgeHeight.GetMin() * CapsuleScale - UCharacterMovementComponent::MAX_FLOOR_DIST,
+				LedgeHeightDelta + 3.5f * TraceCapsuleRadius + UCharacterMovementComponent::MIN_FLOOR_DIST
+			};
+
+			if (LedgeSubsystem->QueryLedge(CapsuleBottomLocation, LedgeSearchRadius, LedgeSearchHeight, ForwardTraceDirection) ==
+			    EAlsMantlingLedgeQueryResult::NoLedge &&
+			    ++MantlingState.BakedLedgesSkippedTracesCount < Settings->Mantling.BakedLedgesInAirTraceInterval)
+			{
+				return false;
+			}
+		}
+
+		MantlingState.BakedLedgesSkippedTracesCount = 0;
+	}
+
+	// Forward and downward sweeps, followed by target and start location overlaps.
+
+	static constexpr auto QueriesCount{4};
+
+	if (LocomotionMode == AlsLocomotionModeTags::InAir)
+	{
+		// In-air mantling is attempted every frame, so it will be attempted again
+		// on one of the next frames if the scene query budget is exhausted.
+
+		if (!UAlsSceneQuerySubsystem::TryAcquireQueriesInWorld(GetWorld(), this, ActorLocation, EAlsSceneQueryCategory::Mantling,
+		                                                       &MantlingState.DeferredQueriesCount, QueriesCount))
+		{
+			return false;
+		}
+	}
+	else
+	{
+		// Grounded mantling is a one-time attempt usually made in response to player input, for example, instead of a jump,
+		// so it is never deferred, because its caller cannot tell a deferral from a failure and would do something else.
+
+		UAlsSceneQuerySubsystem::RecordQueriesInWorld(GetWorld(), EAlsSceneQueryCategory::Mantling, QueriesCount);
+	}
+
 	// Trace forward to find an object the character cannot walk on.
 
 	static const FName ForwardTraceTag{FString::Printf(TEXT("%hs (Forward Trace)"), __FUNCTION__)};
@@ -860,8 +915,14 @@ void AAlsCharacter::RefreshRagdolling(const float DeltaTime)
 	// as the character's location, we don't do that because the camera depends on the
 	// capsule's bottom location, so its removal will cause the camera to behave erratically.
 
-	bool bGrounded;
-	SetActorLocation(RagdollTraceGround(bGrounded), false, nullptr, ETeleportType::TeleportPhysics);
+	// If the scene query budget is exhausted, the capsule simply stays at its previous location for this frame.
+
+	if (UAlsSceneQuerySubsystem::TryAcquireQueriesInWorld(GetWorld(), this, PelvisLocation, EAlsSceneQueryCategory::Ragdolling,
+	                                                      &RagdollingState.DeferredQueriesCount))
+	{
+		bool bGrounded;
+		SetActorLocation(RagdollTraceGround(bGrounded), false, nullptr, ETeleportType::TeleportPhysics);
+	}
 
 	// Zero target location means that it hasn't been replicated yet, so we can't apply the logic below.
 
@@ -1031,7 +1092,7 @@ void AAlsCharacter::StopRagdollingImplementation()
 		return;
 	}
 
-	auto& FinalRagdollPose{AnimationInstance->SnapshotFinalRagdollPose()};
+	auto& FinalRagdollPose{AnimationInstance->SnapshotFinalRagdollPose(Settings->Ragdolling.bSnapshotOnlySimulatedBones)};
 
 	const auto PelvisTransform{GetMesh()->GetSocketTransform(UAlsConstants::PelvisBoneName())};
 	const auto PelvisRotation{PelvisTransform.Rotator()};
@@ -1049,6 +1110,8 @@ void AAlsCharacter::StopRagdollingImplementation()
 	GetCharacterMovement()->NetworkSmoothingMode = ENetworkSmoothingMode::Exponential;
 	GetCharacterMovement()->bIgnoreClientMovementErrorChecksAndCorrection = false;
 
+	UAlsSceneQuerySubsystem::RecordQueriesInWorld(GetWorld(), EAlsSceneQueryCategory::Ragdolling);
+
 	bool bGrounded;
 	const auto NewActorLocation{RagdollTraceGround(bGrounded)};
 
@@ -1086,10 +1149,8 @@ void AAlsCharacter::StopRagdollingImplementation()
 	// Restore the pelvis transform to the state it was in before we changed
 	// the character and mesh transforms to keep its world transform unchanged.
 
-	const auto& ReferenceSkeleton{GetMesh()->GetSkinnedAsset()->GetRefSkeleton()};
-
-	const auto PelvisBoneIndex{ReferenceSkeleton.FindBoneIndex(UAlsConstants::PelvisBoneName())};
-	if (ALS_ENSURE(PelvisBoneIndex >= 0))
+	const auto PelvisBoneIndex{AnimationInstance->GetFinalRagdollPosePelvisBoneIndex()};
+	if (ALS_ENSURE(FinalRagdollPose.LocalTransforms.IsValidIndex(PelvisBoneIndex)))
 	{
 		// We expect the pelvis bone to be the root bone or attached to it, so we can safely use the mesh transform here.
 		FinalRagdollPose.LocalTransforms[PelvisBoneIndex] = PelvisTransform.GetRelativeTransform(GetMesh()->GetComponentTransform());
@@ -0,0 +1,198 @@
+#include "AlsCharacter.h"
+
+#include "Settings/AlsCharacterSettings.h"
+#include "Utility/AlsNetworkStats.h"
+#include "Utility/AlsUtility.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Net Update State: Idle"), STAT_AlsNetUpdateState_Idle, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Net Update State: Moving"), STAT_AlsNetUpdateState_Moving, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Net Update State: Sprinting"), STAT_AlsNetUpdateState_Sprinting, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Net Update State: In Air"), STAT_AlsNetUpdateState_InAir, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Net Update State: Locomotion Action"), STAT_AlsNetUpdateState_LocomotionAction, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Net Update State: Ragdolling"), STAT_AlsNetUpdateState_Ragdolling, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Net Update State: Ragdolling Settled"), STAT_AlsNetUpdateState_RagdollingSettled, STATGROUP_Als)
+
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Net Update Rate: Idle"), STAT_AlsNetUpdateRate_Idle, STATGROUP_Als)
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Net Update Rate: Moving"), STAT_AlsNetUpdateRate_Moving, STATGROUP_Als)
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Net Update Rate: Sprinting"), STAT_AlsNetUpdateRate_Sprinting, STATGROUP_Als)
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Net Update Rate: In Air"), STAT_AlsNetUpdateRate_InAir, STATGROUP_Als)
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Net Update Rate: Locomotion Action"), STAT_AlsNetUpdateRate_LocomotionAction, STATGROUP_Als)
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Net Update Rate: Ragdolling"), STAT_AlsNetUpdateRate_Ragdolling, STATGROUP_Als)
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Net Update Rate: Ragdolling Settled"), STAT_AlsNetUpdateRate_RagdollingSettled, STATGROUP_Als)
+
+namespace AlsCharacterNetworking
+{
+	// The net update frequency is not applied to the actor until it differs from the current one by at least this value.
+	constexpr auto NetUpdateFrequencyApplyThreshold{1.0f};
+
+	void IncrementNetUpdateStateStats(const EAlsNetUpdateState NetUpdateState, const float NetUpdateFrequency)
+	{
+#if STATS
+		switch (NetUpdateState)
+		{
+			case EAlsNetUpdateState::Idle:
+				INC_DWORD_STAT(STAT_AlsNetUpdateState_Idle)
+				INC_FLOAT_STAT_BY(STAT_AlsNetUpdateRate_Idle, NetUpdateFrequency)
+				break;
+
+			case EAlsNetUpdateState::Moving:
+				INC_DWORD_STAT(STAT_AlsNetUpdateState_Moving)
+				INC_FLOAT_STAT_BY(STAT_AlsNetUpdateRate_Moving, NetUpdateFrequency)
+				break;
+
+			case EAlsNetUpdateState::Sprinting:
+				INC_DWORD_STAT(STAT_AlsNetUpdateState_Sprinting)
+				INC_FLOAT_STAT_BY(STAT_AlsNetUpdateRate_Sprinting, NetUpdateFrequency)
+				break;
+
+			case EAlsNetUpdateState::InAir:
+				INC_DWORD_STAT(STAT_AlsNetUpdateState_InAir)
+				INC_FLOAT_STAT_BY(STAT_AlsNetUpdateRate_InAir, NetUpdateFrequency)
+				break;
+
+			case EAlsNetUpdateState::LocomotionAction:
+				INC_DWORD_STAT(STAT_AlsNetUpdateState_LocomotionAction)
+				INC_FLOAT_STAT_BY(STAT_AlsNetUpdateRate_LocomotionAction, NetUpdateFrequency)
+				break;
+
+			case EAlsNetUpdateState::Ragdolling:
+				INC_DWORD_STAT(STAT_AlsNetUpdateState_Ragdolling)
+				INC_FLOAT_STAT_BY(STAT_AlsNetUpdateRate_Ragdolling, NetUpdateFrequency)
+				break;
+
+			case EAlsNetUpdateState::RagdollingSettled:
+				INC_DWORD_STAT(STAT_AlsNetUpdateState_RagdollingSettled)
+				INC_FLOAT_STAT_BY(STAT_AlsNetUpdateRate_RagdollingSettled, NetUpdateFrequency)
+				break;
+		}
+#endif
+	}
+}
+
+void AAlsCharacter::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	AlsNetworkStats::RecordReplicatedProperties(this, StaticClass());
+}
+
+bool AAlsCharacter::CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack)
+{
+	AlsNetworkStats::RecordRemoteFunction(this, Function, Parameters, StaticClass());
+
+	return Super::CallRemoteFunction(Function, Parameters, OutParms, Stack);
+}
+
+EAlsNetUpdateState AAlsCharacter::CalculateNetUpdateState() const
+{
+	if (LocomotionAction == AlsLocomotionActionTags::Ragdolling)
+	{
+		return RagdollingState.Velocity.SizeSquared() <
+		       FMath::Square(Settings->NetUpdateFrequency.RagdollingSettledSpeedThreshold)
+			       ? EAlsNetUpdateState::RagdollingSettled
+			       : EAlsNetUpdateState::Ragdolling;
+	}
+
+	if (LocomotionAction.IsValid())
+	{
+		return EAlsNetUpdateState::LocomotionAction;
+	}
+
+	if (LocomotionMode == AlsLocomotionModeTags::InAir)
+	{
+		return EAlsNetUpdateState::InAir;
+	}
+
+	if (!LocomotionState.bHasVelocity && !LocomotionState.bHasInput)
+	{
+		return EAlsNetUpdateState::Idle;
+	}
+
+	return Gait == AlsGaitTags::Sprinting ? EAlsNetUpdateState::Sprinting : EAlsNetUpdateState::Moving;
+}
+
+void AAlsCharacter::RefreshNetUpdateFrequency(const float DeltaTime)
+{
+	const auto& NetUpdateSettings{Settings->NetUpdateFrequency};
+
+	if (!NetUpdateSettings.bEnableAdaptiveNetUpdateFrequency || GetLocalRole() < ROLE_Authority || IsNetMode(NM_Standalone))
+	{
+		return;
+	}
+
+	NetUpdateState = CalculateNetUpdateState();
+
+	float TargetNetUpdateFrequency;
+
+	switch (NetUpdateState)
+	{
+		case EAlsNetUpdateState::Moving:
+			TargetNetUpdateFrequency = NetUpdateSettings.MovingNetUpdateFrequency;
+			break;
+
+		case EAlsNetUpdateState::Sprinting:
+			TargetNetUpdateFrequency = NetUpdateSettings.SprintingNetUpdateFrequency;
+			break;
+
+		case EAlsNetUpdateState::InAir:
+			TargetNetUpdateFrequency = NetUpdateSettings.InAirNetUpdateFrequency;
+			break;
+
+		case EAlsNetUpdateState::LocomotionAction:
+			TargetNetUpdateFrequency = NetUpdateSettings.LocomotionActionNetUpdateFrequency;
+			break;
+
+		case EAlsNetUpdateState::Ragdolling:
+			TargetNetUpdateFrequency = NetUpdateSettings.RagdollingNetUpdateFrequency;
+			break;
+
+		case EAlsNetUpdateState::RagdollingSettled:
+			TargetNetUpdateFrequency = NetUpdateSettings.RagdollingSettledNetUpdateFrequency;
+			break;
+
+		default:
+			TargetNetUpdateFrequency = NetUpdateSettings.IdleNetUpdateFrequency;
+			break;
+	}
+
+	if (ViewState.YawSpeed > NetUpdateSettings.FastViewYawSpeedThreshold)
+	{
+		TargetNetUpdateFrequency = FMath::Max(TargetNetUpdateFrequency, NetUpdateSettings.FastViewRotationNetUpdateFrequency);
+	}
+
+	TargetNetUpdateFrequency = FMath::Clamp(TargetNetUpdateFrequency, NetUpdateSettings.NetUpdateFrequencyRange.X,
+	                                        NetUpdateSettings.NetUpdateFrequencyRange.Y);
+
+	// Raise the frequency instantly so that important changes are not delayed, but lower it gradually.
+
+	if (AdaptiveNetUpdateFrequency <= 0.0f || TargetNetUpdateFrequency >= AdaptiveNetUpdateFrequency)
+	{
+		AdaptiveNetUpdateFrequency = TargetNetUpdateFrequency;
+	}
+	else
+	{
+		AdaptiveNetUpdateFrequency = FMath::Max(TargetNetUpdateFrequency,
+		                                        AdaptiveNetUpdateFrequency - NetUpdateSettings.NetUpdateFrequencyDecreaseRate * DeltaTime);
+	}
+
+	const auto NetUpdateFrequency{GetNetUpdateFrequency()};
+
+	if (AdaptiveNetUpdateFrequency != NetUpdateFrequency &&
+	    (AdaptiveNetUpdateFrequency == TargetNetUpdateFrequency ||
+	     FMath::Abs(AdaptiveNetUpdateFrequency - NetUpdateFrequency) >= AlsCharacterNetworking::NetUpdateFrequencyApplyThreshold))
+	{
+		SetNetUpdateFrequency(AdaptiveNetUpdateFrequency);
+	}
+
+	AlsCharacterNetworking::IncrementNetUpdateStateStats(NetUpdateState, GetNetUpdateFrequency());
+}
+
+void AAlsCharacter::ForceNetUpdateOnStateChange()
+{
+	if (IsValid(Settings) && Settings->NetUpdateFrequency.bEnableAdaptiveNetUpdateFrequency &&
+	    Settings->NetUpdateFrequency.bForceNetUpdateOnStateChange &&
+	    GetLocalRole() >= ROLE_Authority && !IsNetMode(NM_Standalone))
+	{
+		ForceNetUpdate();
+	}
+}
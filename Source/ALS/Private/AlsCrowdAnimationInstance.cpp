@@ -0,0 +1,17 @@
+#include "AlsCrowdAnimationInstance.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCrowdAnimationInstance)
+
+void UAlsCrowdAnimationInstance::RefreshLodOnGameThread()
+{
+	Super::RefreshLodOnGameThread();
+
+	LodState.bLayeringDisabled = true;
+	LodState.bFeetDisabled = true;
+	LodState.bFootLockDisabled = true;
+	LodState.bTransitionsDisabled = true;
+	LodState.bDynamicTransitionsDisabled = true;
+	LodState.bLookDisabled = true;
+	LodState.bGroundPredictionDisabled = true;
+	LodState.LeanUpdateInterval = FMath::Max(LodState.LeanUpdateInterval, LeanUpdateInterval);
+}
@@ -0,0 +1,241 @@
+#include "AlsMantlingLedgeIndex.h"
+
+#include "AlsMantlingLedgeSubsystem.h"
+#include "Algo/BinarySearch.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "Settings/AlsCharacterSettings.h"
+#include "Utility/AlsLog.h"
+#include "Utility/AlsMacros.h"
+#include "Utility/AlsUtility.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsMantlingLedgeIndex)
+
+namespace AlsMantlingLedgeIndex
+{
+	// Limits the number of stacked surfaces that can be found in a single sample column.
+	constexpr auto MaxTracesPerColumn{16};
+}
+
+AAlsMantlingLedgeIndex::AAlsMantlingLedgeIndex()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	SetCanBeDamaged(false);
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+}
+
+void AAlsMantlingLedgeIndex::BeginPlay()
+{
+	Super::BeginPlay();
+
+	auto* Subsystem{GetWorld()->GetSubsystem<UAlsMantlingLedgeSubsystem>()};
+	if (IsValid(Subsystem) && !Ledges.IsEmpty())
+	{
+		Subsystem->RegisterIndex(this);
+	}
+}
+
+void AAlsMantlingLedgeIndex::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	auto* Subsystem{GetWorld()->GetSubsystem<UAlsMantlingLedgeSubsystem>()};
+	if (IsValid(Subsystem))
+	{
+		Subsystem->UnregisterIndex(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+#if WITH_EDITOR
+void AAlsMantlingLedgeIndex::BakeLedges()
+{
+	const auto* World{GetWorld()};
+	if (!ALS_ENSURE(IsValid(World)) || !ALS_ENSURE_MESSAGE(IsValid(CharacterSettings),
+	                                                       TEXT("Character settings are required to bake mantling ledges.")))
+	{
+		return;
+	}
+
+	const auto& MantlingSettings{CharacterSettings->Mantling};
+
+	const FVector2f LedgeHeight{
+		FMath::Min(MantlingSettings.GroundedTrace.LedgeHeight.GetMin(), MantlingSettings.InAirTrace.LedgeHeight.GetMin()),
+		FMath::Max(MantlingSettings.GroundedTrace.LedgeHeight.GetMax(), MantlingSettings.InAirTrace.LedgeHeight.GetMax())
+	};
+
+	Modify();
+
+	Ledges.Reset();
+
+	BakedBounds = FBox::BuildAABB(GetActorLocation(), BakeExtent);
+	BakedCellSize = CellSize;
+	BakedSampleSpacing = SampleSpacing;
+
+	const auto SamplesCountX{FMath::Max(1, FMath::CeilToInt32(BakeExtent.X * 2.0f / SampleSpacing) + 1)};
+	const auto SamplesCountY{FMath::Max(1, FMath::CeilToInt32(BakeExtent.Y * 2.0f / SampleSpacing) + 1)};
+
+	static const FName TraceTag{FString::Printf(TEXT("%hs (Surface Trace)"), __FUNCTION__)};
+
+	// Collect the walkable static surfaces of each sample column, ordered from top to bottom.
+
+	TArray<TArray<float, TInlineAllocator<4>>> Columns;
+	Columns.SetNum(SamplesCountX * SamplesCountY);
+
+	for (auto Y{0}; Y < SamplesCountY; Y++)
+	{
+		for (auto X{0}; X < SamplesCountX; X++)
+		{
+			auto& Column{Columns[Y * SamplesCountX + X]};
+
+			const auto SampleX{BakedBounds.Min.X + X * SampleSpacing};
+			const auto SampleY{BakedBounds.Min.Y + Y * SampleSpacing};
+
+			auto TraceStartZ{BakedBounds.Max.Z};
+
+			for (auto i{0}; i < AlsMantlingLedgeIndex::MaxTracesPerColumn && TraceStartZ > BakedBounds.Min.Z; i++)
+			{
+				FHitResult Hit;
+				if (!World->LineTraceSingleByChannel(Hit, {SampleX, SampleY, TraceStartZ}, {SampleX, SampleY, BakedBounds.Min.Z},
+				                                     MantlingSettings.MantlingTraceChannel, {TraceTag, false, this},
+				                                     MantlingSettings.MantlingTraceResponses))
+				{
+					break;
+				}
+
+				if (Hit.bStartPenetrating)
+				{
+					// Skip the inside of the geometry the trace started in.
+
+					TraceStartZ -= SampleSpacing;
+					continue;
+				}
+
+				const auto* Primitive{Hit.GetComponent()};
+
+				if (IsValid(Primitive) && Primitive->Mobility == EComponentMobility::Static &&
+				    Hit.ImpactNormal.Z >= MantlingSettings.SlopeAngleThresholdCos)
+				{
+					Column.Add(UE_REAL_TO_FLOAT(Hit.ImpactPoint.Z));
+				}
+
+				TraceStartZ = Hit.ImpactPoint.Z - 1.0f;
+			}
+		}
+	}
+
+	// A ledge is a surface whose neighbor column continues at a lower height that the character can mantle from.
+
+	static const FIntPoint NeighborOffsets[]{{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+
+	for (auto Y{0}; Y < SamplesCountY; Y++)
+	{
+		for (auto X{0}; X < SamplesCountX; X++)
+		{
+			for (const auto SurfaceZ : Columns[Y * SamplesCountX + X])
+			{
+				for (const auto& Offset : NeighborOffsets)
+				{
+					const auto NeighborX{X + Offset.X};
+					const auto NeighborY{Y + Offset.Y};
+
+					if (NeighborX < 0 || NeighborX >= SamplesCountX || NeighborY < 0 || NeighborY >= SamplesCountY)
+					{
+						continue;
+					}
+
+					const auto* NeighborSurfaceZ{
+						Columns[NeighborY * SamplesCountX + NeighborX].FindByPredicate([SurfaceZ](const float Z)
+						{
+							return Z <= SurfaceZ + 1.0f;
+						})
+					};
+
+					if (NeighborSurfaceZ == nullptr)
+					{
+						continue;
+					}
+
+					const auto Height{SurfaceZ - *NeighborSurfaceZ};
+					if (Height < LedgeHeight.X || Height > LedgeHeight.Y)
+					{
+						continue;
+					}
+
+					auto& Ledge{Ledges.Emplace_GetRef()};
+
+					Ledge.Location.X = UE_REAL_TO_FLOAT(BakedBounds.Min.X + (X + Offset.X * 0.5f) * SampleSpacing);
+					Ledge.Location.Y = UE_REAL_TO_FLOAT(BakedBounds.Min.Y + (Y + Offset.Y * 0.5f) * SampleSpacing);
+					Ledge.Location.Z = SurfaceZ;
+
+					Ledge.Normal.X = static_cast<float>(Offset.X);
+					Ledge.Normal.Y = static_cast<float>(Offset.Y);
+				}
+			}
+		}
+	}
+
+	Ledges.Sort([this](const FAlsMantlingLedge& A, const FAlsMantlingLedge& B)
+	{
+		return CalculateCellKey(A.Location) < CalculateCellKey(B.Location);
+	});
+
+	Ledges.Shrink();
+
+	UE_LOG(LogAls, Log, TEXT("%s: baked %d mantling ledges."), *GetName(), Ledges.Num())
+}
+#endif
+
+bool AAlsMantlingLedgeIndex::HasLedgeNear(const FVector& Location, float Radius, const FVector2f& HeightRange,
+                                          const FVector& Direction) const
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsMantlingLedgeIndex::HasLedgeNear"), STAT_AAlsMantlingLedgeIndex_HasLedgeNear, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	// Baked ledge locations can be off by up to half of the sample spacing.
+
+	Radius += BakedSampleSpacing * 0.5f;
+
+	const FVector3f QueryLocation{Location};
+	const FVector2f QueryLocation2D{QueryLocation};
+	const FVector2f QueryDirection{FVector3f{Direction}};
+	const auto RadiusSquared{FMath::Square(Radius)};
+
+	const auto MinCellX{FMath::FloorToInt32((QueryLocation.X - Radius) / BakedCellSize)};
+	const auto MaxCellX{FMath::FloorToInt32((QueryLocation.X + Radius) / BakedCellSize)};
+	const auto MinCellY{FMath::FloorToInt32((QueryLocation.Y - Radius) / BakedCellSize)};
+	const auto MaxCellY{FMath::FloorToInt32((QueryLocation.Y + Radius) / BakedCellSize)};
+
+	// Cells of the same row are stored contiguously, so each row is a single range in the sorted ledge array.
+
+	for (auto CellY{MinCellY}; CellY <= MaxCellY; CellY++)
+	{
+		const auto RowEndKey{MakeCellKey(MaxCellX, CellY)};
+
+		for (auto i{
+			     Algo::LowerBoundBy(Ledges, MakeCellKey(MinCellX, CellY), [this](const FAlsMantlingLedge& Ledge)
+			     {
+				     return CalculateCellKey(Ledge.Location);
+			     })
+		     }; i < Ledges.Num(); i++)
+		{
+			const auto& Ledge{Ledges[i]};
+
+			if (CalculateCellKey(Ledge.Location) > RowEndKey)
+			{
+				break;
+			}
+
+			const auto Height{Ledge.Location.Z - QueryLocation.Z};
+
+			if (Height >= HeightRange.X && Height <= HeightRange.Y && (Ledge.Normal | QueryDirection) < 0.0f &&
+			    FVector2f::DistSquared(FVector2f{Ledge.Location}, QueryLocation2D) <= RadiusSquared)
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,46 @@
+#include "AlsMantlingLedgeSubsystem.h"
+
+#include "AlsMantlingLedgeIndex.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsMantlingLedgeSubsystem)
+
+void UAlsMantlingLedgeSubsystem::RegisterIndex(AAlsMantlingLedgeIndex* Index)
+{
+	Indices.AddUnique(Index);
+}
+
+void UAlsMantlingLedgeSubsystem::UnregisterIndex(AAlsMantlingLedgeIndex* Index)
+{
+	Indices.RemoveSingleSwap(Index);
+}
+
+EAlsMantlingLedgeQueryResult UAlsMantlingLedgeSubsystem::QueryLedge(const FVector& Location, const float Radius,
+                                                                    const FVector2f& HeightRange, const FVector& Direction) const
+{
+	auto Result{EAlsMantlingLedgeQueryResult::NotBaked};
+
+	// The baked bounds must contain the entire query volume, including the reach
+	// radius and the height range, otherwise ledges outside the bounds could be missed.
+
+	const FBox QueryBox{
+		{Location.X - Radius, Location.Y - Radius, Location.Z + HeightRange.X},
+		{Location.X + Radius, Location.Y + Radius, Location.Z + HeightRange.Y}
+	};
+
+	for (const auto* Index : Indices)
+	{
+		if (!IsValid(Index) || !Index->IsInsideBakedBounds(QueryBox))
+		{
+			continue;
+		}
+
+		if (Index->HasLedgeNear(Location, Radius, HeightRange, Direction))
+		{
+			return EAlsMantlingLedgeQueryResult::LedgeFound;
+		}
+
+		Result = EAlsMantlingLedgeQueryResult::NoLedge;
+	}
+
+	return Result;
+}
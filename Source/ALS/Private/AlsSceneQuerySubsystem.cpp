@@ -0,0 +1,236 @@
+#include "AlsSceneQuerySubsystem.h"
+
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Utility/AlsUtility.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsSceneQuerySubsystem)
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Scene Queries: Mantling"), STAT_AlsSceneQueries_Mantling, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Scene Queries: Ground Prediction"), STAT_AlsSceneQueries_GroundPrediction, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Scene Queries: Ragdolling"), STAT_AlsSceneQueries_Ragdolling, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Scene Queries: Footsteps"), STAT_AlsSceneQueries_Footsteps, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Scene Queries: Foot Offset"), STAT_AlsSceneQueries_FootOffset, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Scene Queries: Floor"), STAT_AlsSceneQueries_Floor, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Scene Queries: Camera"), STAT_AlsSceneQueries_Camera, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Scene Queries: Deferred"), STAT_AlsSceneQueries_Deferred, STATGROUP_Als)
+
+namespace AlsSceneQuerySubsystem
+{
+	TAutoConsoleVariable<int32> CVarFrameBudget{
+		TEXT("Als.SceneQueries.FrameBudget"), 0,
+		TEXT("Maximum number of ALS scene queries per frame, after which low priority queries are deferred. 0 means no limit."),
+		ECVF_Default
+	};
+
+	TAutoConsoleVariable<float> CVarDistantBudgetRatio{
+		TEXT("Als.SceneQueries.DistantBudgetRatio"), 0.5f,
+		TEXT("Portion of the frame budget available to queries of distant characters."),
+		ECVF_Default
+	};
+
+	TAutoConsoleVariable<float> CVarNearbyDistance{
+		TEXT("Als.SceneQueries.NearbyDistance"), 3000.0f,
+		TEXT("Characters closer than this distance to any player view are considered nearby."),
+		ECVF_Default
+	};
+
+	TAutoConsoleVariable<int32> CVarMaxDeferredFramesCount{
+		TEXT("Als.SceneQueries.MaxDeferredFramesCount"), 8,
+		TEXT("Maximum number of frames in a row for which the queries of a single caller can be deferred."),
+		ECVF_Default
+	};
+
+	void IncrementQueryStats(const EAlsSceneQueryCategory Category, const int32 QueriesCount)
+	{
+#if STATS
+		switch (Category)
+		{
+			case EAlsSceneQueryCategory::Mantling:
+				INC_DWORD_STAT_BY(STAT_AlsSceneQueries_Mantling, QueriesCount)
+				break;
+
+			case EAlsSceneQueryCategory::GroundPrediction:
+				INC_DWORD_STAT_BY(STAT_AlsSceneQueries_GroundPrediction, QueriesCount)
+				break;
+
+			case EAlsSceneQueryCategory::Ragdolling:
+				INC_DWORD_STAT_BY(STAT_AlsSceneQueries_Ragdolling, QueriesCount)
+				break;
+
+			case EAlsSceneQueryCategory::Footsteps:
+				INC_DWORD_STAT_BY(STAT_AlsSceneQueries_Footsteps, QueriesCount)
+				break;
+
+			case EAlsSceneQueryCategory::FootOffset:
+				INC_DWORD_STAT_BY(STAT_AlsSceneQueries_FootOffset, QueriesCount)
+				break;
+
+			case EAlsSceneQueryCategory::Floor:
+				INC_DWORD_STAT_BY(STAT_AlsSceneQueries_Floor, QueriesCount)
+				break;
+
+			case EAlsSceneQueryCategory::Camera:
+				INC_DWORD_STAT_BY(STAT_AlsSceneQueries_Camera, QueriesCount)
+				break;
+		}
+#endif
+	}
+}
+
+bool UAlsSceneQuerySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAlsSceneQuerySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	WorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddUObject(this, &ThisClass::OnWorldTickStart);
+}
+
+void UAlsSceneQuerySubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldTickStart.Remove(WorldTickStartHandle);
+	WorldTickStartHandle.Reset();
+
+	Super::Deinitialize();
+}
+
+void UAlsSceneQuerySubsystem::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaTime)
+{
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	FrameQueriesCount.store(0, std::memory_order_relaxed);
+
+	LocalPlayerActors.Reset();
+	ViewLocations.Reset();
+
+	for (auto Iterator{World->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+	{
+		const auto* Player{Iterator->Get()};
+		if (!IsValid(Player))
+		{
+			continue;
+		}
+
+		const auto* ViewTarget{Player->GetViewTarget()};
+
+		if (Player->IsLocalController())
+		{
+			LocalPlayerActors.Add(Player->GetPawn());
+			LocalPlayerActors.Add(ViewTarget);
+
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			Player->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+			ViewLocations.Add(ViewLocation);
+		}
+		else if (IsValid(ViewTarget))
+		{
+			// Remote players don't have a reliable camera location on the server, so use the location of their view target instead.
+
+			ViewLocations.Add(ViewTarget->GetActorLocation());
+		}
+	}
+}
+
+EAlsSceneQueryPriority UAlsSceneQuerySubsystem::CalculatePriority(const AActor* Actor, const FVector& Location) const
+{
+	if (Actor != nullptr && LocalPlayerActors.Contains(Actor))
+	{
+		return EAlsSceneQueryPriority::LocalPlayer;
+	}
+
+	const auto NearbyDistanceSquared{FMath::Square(AlsSceneQuerySubsystem::CVarNearbyDistance.GetValueOnAnyThread())};
+
+	for (const auto& ViewLocation : ViewLocations)
+	{
+		if (FVector::DistSquared(ViewLocation, Location) <= NearbyDistanceSquared)
+		{
+			return EAlsSceneQueryPriority::Nearby;
+		}
+	}
+
+	return EAlsSceneQueryPriority::Distant;
+}
+
+bool UAlsSceneQuerySubsystem::TryAcquireQueries(const EAlsSceneQueryCategory Category, const EAlsSceneQueryPriority Priority,
+                                                int32* DeferredFramesCount, const int32 QueriesCount)
+{
+	const auto FrameBudget{AlsSceneQuerySubsystem::CVarFrameBudget.GetValueOnAnyThread()};
+
+	if (FrameBudget > 0 && Priority != EAlsSceneQueryPriority::LocalPlayer &&
+	    (DeferredFramesCount == nullptr ||
+	     *DeferredFramesCount < AlsSceneQuerySubsystem::CVarMaxDeferredFramesCount.GetValueOnAnyThread()))
+	{
+		const auto PriorityBudget{
+			Priority == EAlsSceneQueryPriority::Nearby
+				? FrameBudget
+				: FMath::Max(1, FMath::FloorToInt(FrameBudget * AlsSceneQuerySubsystem::CVarDistantBudgetRatio.GetValueOnAnyThread()))
+		};
+
+		// Reserve the queries first and roll the reservation back if it doesn't fit
+		// into the budget, so that concurrent callers cannot exceed the budget together.
+
+		if (FrameQueriesCount.fetch_add(QueriesCount, std::memory_order_relaxed) + QueriesCount > PriorityBudget)
+		{
+			FrameQueriesCount.fetch_sub(QueriesCount, std::memory_order_relaxed);
+
+			if (DeferredFramesCount != nullptr)
+			{
+				*DeferredFramesCount += 1;
+			}
+
+			INC_DWORD_STAT_BY(STAT_AlsSceneQueries_Deferred, QueriesCount)
+			return false;
+		}
+	}
+	else
+	{
+		FrameQueriesCount.fetch_add(QueriesCount, std::memory_order_relaxed);
+	}
+
+	if (DeferredFramesCount != nullptr)
+	{
+		*DeferredFramesCount = 0;
+	}
+
+	AlsSceneQuerySubsystem::IncrementQueryStats(Category, QueriesCount);
+	return true;
+}
+
+void UAlsSceneQuerySubsystem::RecordQueries(const EAlsSceneQueryCategory Category, const int32 QueriesCount)
+{
+	FrameQueriesCount.fetch_add(QueriesCount, std::memory_order_relaxed);
+
+	AlsSceneQuerySubsystem::IncrementQueryStats(Category, QueriesCount);
+}
+
+bool UAlsSceneQuerySubsystem::TryAcquireQueriesInWorld(const UWorld* World, const AActor* Actor, const FVector& Location,
+                                                       const EAlsSceneQueryCategory Category, int32* DeferredFramesCount,
+                                                       const int32 QueriesCount)
+{
+	auto* Subsystem{IsValid(World) ? World->GetSubsystem<ThisClass>() : nullptr};
+	if (!IsValid(Subsystem))
+	{
+		return true;
+	}
+
+	return Subsystem->TryAcquireQueries(Category, Subsystem->CalculatePriority(Actor, Location), DeferredFramesCount, QueriesCount);
+}
+
+void UAlsSceneQuerySubsystem::RecordQueriesInWorld(const UWorld* World, const EAlsSceneQueryCategory Category, const int32 QueriesCount)
+{
+	auto* Subsystem{IsValid(World) ? World->GetSubsystem<ThisClass>() : nullptr};
+	if (IsValid(Subsystem))
+	{
+		Subsystem->RecordQueries(Category, QueriesCount);
+	}
+}
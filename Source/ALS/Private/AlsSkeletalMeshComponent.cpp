@@ -0,0 +1,48 @@
+#include "AlsSkeletalMeshComponent.h"
+
+#include "GameFramework/Character.h"
+#include "Utility/AlsUtility.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsSkeletalMeshComponent)
+
+void UAlsSkeletalMeshComponent::OnRegister()
+{
+	Character = Cast<ACharacter>(GetOwner());
+
+	Super::OnRegister();
+}
+
+void UAlsSkeletalMeshComponent::TickAnimation(const float DeltaTime, const bool bNeedsValidRootMotion)
+{
+	// Synchronize the rotation before the animation update so that the animation instance
+	// proxy caches the already synchronized component transform in FAnimInstanceProxy::PreUpdate().
+
+	SynchronizeAbsoluteRotation();
+
+	Super::TickAnimation(DeltaTime, bNeedsValidRootMotion);
+}
+
+void UAlsSkeletalMeshComponent::SynchronizeAbsoluteRotation()
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsSkeletalMeshComponent::SynchronizeAbsoluteRotation"),
+	                            STAT_UAlsSkeletalMeshComponent_SynchronizeAbsoluteRotation, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	if (!IsUsingAbsoluteRotation() || !IsValid(Character) || !IsValid(GetAttachParent()))
+	{
+		return;
+	}
+
+	const auto NewRotation{GetAttachParent()->GetComponentQuat() * Character->GetBaseRotationOffset()};
+
+	if (GetComponentQuat().Equals(NewRotation, 0.0f))
+	{
+		return;
+	}
+
+	// When using absolute rotation, the relative rotation is the world rotation. Unlike USceneComponent::MoveComponent(),
+	// this only updates the component transform and its children, without checking for overlaps or sweeping.
+
+	SetRelativeRotation_Direct(GetRelativeRotationCache().QuatToRotator(NewRotation));
+	UpdateComponentToWorld();
+}
@@ -1,5 +1,6 @@
 #include "Nodes/AlsRigUnit_FootOffsetTrace.h"
 
+#include "AlsSceneQuerySubsystem.h"
 #include "Engine/HitResult.h"
 #include "Engine/World.h"
 
@@ -21,6 +22,21 @@ FAlsRigUnit_FootOffsetTrace_Execute()
 	const FVector TraceStart{FootTargetLocation.X, FootTargetLocation.Y, TraceDistanceUpward};
 	const FVector TraceEnd{FootTargetLocation.X, FootTargetLocation.Y, -TraceDistanceDownward};
 
+	// Keep the previous offset if the scene query budget is exhausted, unless there is no previous offset yet.
+
+	if (!UAlsSceneQuerySubsystem::TryAcquireQueriesInWorld(ExecuteContext.GetWorld(), ExecuteContext.GetOwningActor(),
+	                                                       ExecuteContext.ToWorldSpace(TraceStart),
+	                                                       EAlsSceneQueryCategory::FootOffset, &DeferredQueriesCount))
+	{
+		if (OffsetNormal.IsZero())
+		{
+			OffsetLocationZ = 0.0f;
+			OffsetNormal = FVector::ZAxisVector;
+		}
+
+		return;
+	}
+
 	FHitResult Hit;
 	ExecuteContext.GetWorld()->LineTraceSingleByChannel(Hit, ExecuteContext.ToWorldSpace(TraceStart), ExecuteContext.ToWorldSpace(TraceEnd),
 	                                                    TraceChannel, {__FUNCTION__, true, ExecuteContext.GetOwningActor()});
@@ -1,6 +1,7 @@
 #include "Notifies/AlsAnimNotify_FootstepEffects.h"
 
 #include "AlsCharacter.h"
+#include "AlsSceneQuerySubsystem.h"
 #include "DrawDebugHelpers.h"
 #include "NiagaraFunctionLibrary.h"
 #include "Animation/AnimInstance.h"
@@ -99,6 +100,14 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 	const auto& FootBoneName{FootBone == EAlsFootBone::Left ? UAlsConstants::FootLeftBoneName() : UAlsConstants::FootRightBoneName()};
 	const auto FootTransform{Mesh->GetSocketTransform(FootBoneName)};
 
+	// Footstep effects have no state to reuse between notifies, so they are skipped entirely if the scene query budget is exhausted.
+
+	if (!UAlsSceneQuerySubsystem::TryAcquireQueriesInWorld(World, Mesh->GetOwner(), FootTransform.GetLocation(),
+	                                                       EAlsSceneQueryCategory::Footsteps))
+	{
+		return;
+	}
+
 	const auto FootZAxis{
 		FootTransform.TransformVectorNoScale(FootBone == EAlsFootBone::Left
 			                                     ? FVector{FootstepEffectsSettings->FootLeftZAxis}
@@ -116,6 +125,8 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 	{
 		// As a fallback, trace down the world Z axis if the first trace didn't hit anything.
 
+		UAlsSceneQuerySubsystem::RecordQueriesInWorld(World, EAlsSceneQueryCategory::Footsteps);
+
 		World->LineTraceSingleByChannel(FootstepHit, FootTransform.GetLocation(),
 		                                FootTransform.GetLocation() - FVector{
 			                                0.0f, 0.0f, FootstepEffectsSettings->SurfaceTraceDistance * MeshScale
@@ -0,0 +1,18 @@
+#include "Settings/AlsLodSettings.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsLodSettings)
+
+const FAlsLodFeatureSettings* FAlsLodSettings::FindFeatures(const int32 LodLevel) const
+{
+	const FAlsLodFeatureSettings* Result{nullptr};
+
+	for (const auto& Entry : Features)
+	{
+		if (Entry.MinLod <= LodLevel && (Result == nullptr || Entry.MinLod > Result->MinLod))
+		{
+			Result = &Entry;
+		}
+	}
+
+	return Result;
+}
@@ -0,0 +1,59 @@
+#include "Utility/AlsDebugDrawBuffer.h"
+
+#if ENABLE_DRAW_DEBUG
+
+#include "Engine/HitResult.h"
+#include "Utility/AlsDebugUtility.h"
+
+void FAlsDebugDrawBuffer::AddSweepCapsule(const FVector& Start, const FVector& End, const FRotator& Rotation, const float Radius,
+                                          const float HalfHeight, const bool bHit, const FHitResult& Hit,
+                                          const FLinearColor& SweepColor, const FLinearColor& HitColor)
+{
+	const auto Index{CommandsCount.fetch_add(1)};
+	if (Index >= Capacity)
+	{
+		return;
+	}
+
+	auto& Command{Commands[Index]};
+
+	Command.bHit = bHit && Hit.bBlockingHit;
+	Command.Start = Start;
+	Command.End = End;
+	Command.Rotation = Rotation;
+	Command.HitLocation = Hit.Location;
+	Command.HitImpactPoint = Hit.ImpactPoint;
+	Command.Radius = Radius;
+	Command.HalfHeight = HalfHeight;
+	Command.Color = SweepColor;
+	Command.HitColor = HitColor;
+}
+
+void FAlsDebugDrawBuffer::Flush(const UObject* WorldContext)
+{
+	check(IsInGameThread())
+
+	const auto Count{FMath::Min(CommandsCount.exchange(0), static_cast<int32>(Capacity))};
+
+	FHitResult Hit;
+
+	for (auto i{0}; i < Count; i++)
+	{
+		const auto& Command{Commands[i]};
+
+		Hit.bBlockingHit = Command.bHit;
+		Hit.Location = Command.HitLocation;
+		Hit.ImpactPoint = Command.HitImpactPoint;
+
+		UAlsDebugUtility::DrawSweepSingleCapsule(WorldContext, Command.Start, Command.End, Command.Rotation,
+		                                         Command.Radius, Command.HalfHeight, Command.bHit,
+		                                         Hit, Command.Color, Command.HitColor);
+	}
+}
+
+void FAlsDebugDrawBuffer::Reset()
+{
+	CommandsCount = 0;
+}
+
+#endif
@@ -0,0 +1,110 @@
+#include "Utility/AlsFootSolverBatch.h"
+
+void FAlsFootSolverBatch::TransformBy(const FTransform& Transform)
+{
+	const auto& Rotation{Transform.GetRotation()};
+	const auto& Translation{Transform.GetTranslation()};
+	const auto& Scale{Transform.GetScale3D()};
+
+	const auto QX{VectorSetFloat1(Rotation.X)};
+	const auto QY{VectorSetFloat1(Rotation.Y)};
+	const auto QZ{VectorSetFloat1(Rotation.Z)};
+	const auto QW{VectorSetFloat1(Rotation.W)};
+
+	// Locations. Same as FQuat::RotateVector(), i.e. V' = V + 2 * W * (Q x V) + Q x (2 * (Q x V)).
+
+	const auto X{VectorMultiply(VectorLoadAligned(LocationX), VectorSetFloat1(Scale.X))};
+	const auto Y{VectorMultiply(VectorLoadAligned(LocationY), VectorSetFloat1(Scale.Y))};
+	const auto Z{VectorMultiply(VectorLoadAligned(LocationZ), VectorSetFloat1(Scale.Z))};
+
+	const auto Two{VectorSetFloat1(2.0)};
+
+	const auto TX{VectorMultiply(Two, VectorNegateMultiplyAdd(QZ, Y, VectorMultiply(QY, Z)))};
+	const auto TY{VectorMultiply(Two, VectorNegateMultiplyAdd(QX, Z, VectorMultiply(QZ, X)))};
+	const auto TZ{VectorMultiply(Two, VectorNegateMultiplyAdd(QY, X, VectorMultiply(QX, Y)))};
+
+	VectorStoreAligned(VectorAdd(VectorAdd(VectorMultiplyAdd(QW, TX, X), VectorNegateMultiplyAdd(QZ, TY, VectorMultiply(QY, TZ))),
+	                             VectorSetFloat1(Translation.X)), LocationX);
+
+	VectorStoreAligned(VectorAdd(VectorAdd(VectorMultiplyAdd(QW, TY, Y), VectorNegateMultiplyAdd(QX, TZ, VectorMultiply(QZ, TX))),
+	                             VectorSetFloat1(Translation.Y)), LocationY);
+
+	VectorStoreAligned(VectorAdd(VectorAdd(VectorMultiplyAdd(QW, TZ, Z), VectorNegateMultiplyAdd(QY, TX, VectorMultiply(QX, TY))),
+	                             VectorSetFloat1(Translation.Z)), LocationZ);
+
+	// Rotations. Same as FQuat::operator*(), i.e. the Hamilton product of the transform rotation and the lane rotation.
+
+	const auto RX{VectorLoadAligned(RotationX)};
+	const auto RY{VectorLoadAligned(RotationY)};
+	const auto RZ{VectorLoadAligned(RotationZ)};
+	const auto RW{VectorLoadAligned(RotationW)};
+
+	VectorStoreAligned(VectorNegateMultiplyAdd(QZ, RY, VectorMultiplyAdd(QY, RZ, VectorMultiplyAdd(QX, RW, VectorMultiply(QW, RX)))),
+	                   RotationX);
+
+	VectorStoreAligned(VectorMultiplyAdd(QZ, RX, VectorMultiplyAdd(QY, RW, VectorNegateMultiplyAdd(QX, RZ, VectorMultiply(QW, RY)))),
+	                   RotationY);
+
+	VectorStoreAligned(VectorMultiplyAdd(QZ, RW, VectorNegateMultiplyAdd(QY, RX, VectorMultiplyAdd(QX, RY, VectorMultiply(QW, RZ)))),
+	                   RotationZ);
+
+	VectorStoreAligned(VectorNegateMultiplyAdd(QZ, RZ, VectorNegateMultiplyAdd(QY, RY, VectorNegateMultiplyAdd(QX, RX, VectorMultiply(QW, RW)))),
+	                   RotationW);
+}
+
+void FAlsFootSolverBatch::Blend(const FAlsFootSolverBatch& From, const FAlsFootSolverBatch& To,
+                                const double (&Alphas)[LanesCount], FAlsFootSolverBatch& Result)
+{
+	alignas(32) double AlignedAlphas[LanesCount];
+	FMemory::Memcpy(AlignedAlphas, Alphas, sizeof(AlignedAlphas));
+
+	const auto Alpha{VectorLoadAligned(AlignedAlphas)};
+
+	// Locations.
+
+	const auto FromX{VectorLoadAligned(From.LocationX)};
+	const auto FromY{VectorLoadAligned(From.LocationY)};
+	const auto FromZ{VectorLoadAligned(From.LocationZ)};
+
+	VectorStoreAligned(VectorMultiplyAdd(VectorSubtract(VectorLoadAligned(To.LocationX), FromX), Alpha, FromX), Result.LocationX);
+	VectorStoreAligned(VectorMultiplyAdd(VectorSubtract(VectorLoadAligned(To.LocationY), FromY), Alpha, FromY), Result.LocationY);
+	VectorStoreAligned(VectorMultiplyAdd(VectorSubtract(VectorLoadAligned(To.LocationZ), FromZ), Alpha, FromZ), Result.LocationZ);
+
+	// Rotations. The blended quaternions can't get close to zero length, since both inputs are normalized and the
+	// bias keeps them in the same hemisphere, so unlike FQuat::Normalize() there is no fallback to the identity.
+
+	const auto FromRX{VectorLoadAligned(From.RotationX)};
+	const auto FromRY{VectorLoadAligned(From.RotationY)};
+	const auto FromRZ{VectorLoadAligned(From.RotationZ)};
+	const auto FromRW{VectorLoadAligned(From.RotationW)};
+
+	const auto ToRX{VectorLoadAligned(To.RotationX)};
+	const auto ToRY{VectorLoadAligned(To.RotationY)};
+	const auto ToRZ{VectorLoadAligned(To.RotationZ)};
+	const auto ToRW{VectorLoadAligned(To.RotationW)};
+
+	const auto Dot{
+		VectorMultiplyAdd(FromRW, ToRW, VectorMultiplyAdd(FromRZ, ToRZ, VectorMultiplyAdd(FromRY, ToRY, VectorMultiply(FromRX, ToRX))))
+	};
+
+	const auto Bias{
+		VectorSelect(VectorCompareGE(Dot, GlobalVectorConstants::DoubleZero),
+		             GlobalVectorConstants::DoubleOne, VectorNegate(GlobalVectorConstants::DoubleOne))
+	};
+
+	const auto FromAlpha{VectorMultiply(Bias, VectorSubtract(GlobalVectorConstants::DoubleOne, Alpha))};
+
+	const auto RX{VectorMultiplyAdd(FromRX, FromAlpha, VectorMultiply(ToRX, Alpha))};
+	const auto RY{VectorMultiplyAdd(FromRY, FromAlpha, VectorMultiply(ToRY, Alpha))};
+	const auto RZ{VectorMultiplyAdd(FromRZ, FromAlpha, VectorMultiply(ToRZ, Alpha))};
+	const auto RW{VectorMultiplyAdd(FromRW, FromAlpha, VectorMultiply(ToRW, Alpha))};
+
+	const auto InverseLength{
+		VectorReciprocalSqrt(VectorMultiplyAdd(RW, RW, VectorMultiplyAdd(RZ, RZ, VectorMultiplyAdd(RY, RY, VectorMultiply(RX, RX)))))
+	};
+
+	VectorStoreAligned(VectorMultiply(RX, InverseLength), Result.RotationX);
+	VectorStoreAligned(VectorMultiply(RY, InverseLength), Result.RotationY);
+	VectorStoreAligned(VectorMultiply(RZ, InverseLength), Result.RotationZ);
+	VectorStoreAligned(VectorMultiply(RW, InverseLength), Result.RotationW);
+}
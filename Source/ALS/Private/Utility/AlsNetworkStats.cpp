@@ -0,0 +1,395 @@
+#include "Utility/AlsNetworkStats.h"
+
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "Net/UnrealNetwork.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "UObject/CoreNet.h"
+#include "UObject/ObjectKey.h"
+#include "Utility/AlsUtility.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Network Property Bits"), STAT_AlsNetworkStats_PropertyBits, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Network RPC Bits"), STAT_AlsNetworkStats_RpcBits, STATGROUP_Als)
+
+CSV_DEFINE_CATEGORY(AlsNetwork, true);
+
+namespace AlsNetworkStats
+{
+	// Object references are serialized as network GUIDs, which cannot be done without a package map, so use an estimated size.
+	constexpr auto EstimatedObjectReferenceBits{32};
+
+	TAutoConsoleVariable<bool> CVarEnable{
+		TEXT("Als.NetworkStats.Enable"), false,
+		TEXT("Enables collection of the estimated network cost of ALS replicated properties and RPCs."), ECVF_Cheat
+	};
+
+	struct FEntry
+	{
+		int64 Count{0};
+
+		int64 Bits{0};
+	};
+
+	struct FPropertySnapshot
+	{
+		const FProperty* Property{nullptr};
+
+		void* Value{nullptr};
+
+		ELifetimeCondition Condition{COND_None};
+	};
+
+	struct FActorStats
+	{
+		FString Name;
+
+		TArray<FPropertySnapshot> Snapshots;
+
+		uint8 bSnapshotsInitialized : 1 {false};
+
+		TMap<FName, FEntry> Entries;
+
+		FActorStats() = default;
+
+		FActorStats(const FActorStats&) = delete;
+
+		FActorStats& operator=(const FActorStats&) = delete;
+
+		~FActorStats()
+		{
+			for (const auto& Snapshot : Snapshots)
+			{
+				Snapshot.Property->DestroyAndFreeValue(Snapshot.Value);
+			}
+		}
+	};
+
+	struct FState
+	{
+		double StartTime{FPlatformTime::Seconds()};
+
+		TMap<TObjectKey<AActor>, TUniquePtr<FActorStats>> Actors;
+
+		TMap<FName, FEntry> Aggregate;
+
+		int64 PropertyBits{0};
+
+		int64 RpcBits{0};
+	};
+
+	FState& GetState()
+	{
+		// Intentionally leaked, because the property snapshots cannot be destroyed after the reflection data has been freed on exit.
+
+		static auto* State{new FState};
+		return *State;
+	}
+
+	FString GetActorDisplayName(const AActor* Actor)
+	{
+		FStringView NetModeName;
+
+		switch (Actor->GetNetMode())
+		{
+			case NM_DedicatedServer:
+				NetModeName = TEXTVIEW("Dedicated Server");
+				break;
+
+			case NM_ListenServer:
+				NetModeName = TEXTVIEW("Listen Server");
+				break;
+
+			case NM_Client:
+				NetModeName = TEXTVIEW("Client");
+				break;
+
+			default:
+				NetModeName = TEXTVIEW("Standalone");
+				break;
+		}
+
+		return FString::Printf(TEXT("%s (%.*s, %s)"), *Actor->GetName(), NetModeName.Len(), NetModeName.GetData(),
+		                       *UEnum::GetDisplayValueAsText(Actor->GetLocalRole()).ToString());
+	}
+
+	FActorStats& GetActorStats(const AActor* Actor)
+	{
+		auto& ActorStats{GetState().Actors.FindOrAdd(Actor)};
+
+		if (!ActorStats.IsValid())
+		{
+			ActorStats = MakeUnique<FActorStats>();
+			ActorStats->Name = GetActorDisplayName(Actor);
+		}
+
+		return *ActorStats;
+	}
+
+	int32 CountReceivers(const AActor* Actor, const bool bSkipOwner)
+	{
+		const auto* NetDriver{Actor->GetNetDriver()};
+		if (!IsValid(NetDriver) || !NetDriver->IsServer())
+		{
+			return 0;
+		}
+
+		auto ReceiversCount{NetDriver->ClientConnections.Num()};
+
+		const auto* OwnerConnection{Actor->GetNetConnection()};
+		if (bSkipOwner && IsValid(OwnerConnection) && NetDriver->ClientConnections.Contains(OwnerConnection))
+		{
+			ReceiversCount -= 1;
+		}
+
+		return ReceiversCount;
+	}
+
+	void SerializeValue(FNetBitWriter& Writer, const FProperty* Property, void* Value)
+	{
+		for (auto i{0}; i < Property->ArrayDim; i++)
+		{
+			auto* ElementValue{static_cast<uint8*>(Value) + i * Property->GetElementSize()};
+
+			if (Property->IsA<FObjectPropertyBase>() || Property->IsA<FInterfaceProperty>())
+			{
+				uint32 Placeholder{0};
+				Writer.SerializeBits(&Placeholder, EstimatedObjectReferenceBits);
+				continue;
+			}
+
+			if (const auto* StructProperty{CastField<FStructProperty>(Property)};
+				StructProperty != nullptr && (StructProperty->Struct->StructFlags & STRUCT_NetSerializeNative) == 0)
+			{
+				for (TFieldIterator<FProperty> Iterator{StructProperty->Struct}; Iterator; ++Iterator)
+				{
+					SerializeValue(Writer, *Iterator, Iterator->ContainerPtrToValuePtr<void>(ElementValue));
+				}
+
+				continue;
+			}
+
+			// Containers are not supported by FProperty::NetSerializeItem(), and are not used by ALS anyway.
+
+			if (Property->IsA<FArrayProperty>() || Property->IsA<FSetProperty>() || Property->IsA<FMapProperty>())
+			{
+				continue;
+			}
+
+			Property->NetSerializeItem(Writer, nullptr, ElementValue);
+		}
+	}
+
+	int64 CalculateValueBits(const FProperty* Property, void* Value)
+	{
+		FNetBitWriter Writer{nullptr, 256};
+		Writer.SetAllowResize(true);
+
+		SerializeValue(Writer, Property, Value);
+
+		return Writer.GetNumBits();
+	}
+
+	void AddRecord(FActorStats& ActorStats, const FName& Name, const int64 Bits, const int32 ReceiversCount, const bool bRpc)
+	{
+		const auto TotalBits{Bits * ReceiversCount};
+
+		for (auto* Entries : {&ActorStats.Entries, &GetState().Aggregate})
+		{
+			auto& Entry{Entries->FindOrAdd(Name)};
+			Entry.Count += ReceiversCount;
+			Entry.Bits += TotalBits;
+		}
+
+		if (bRpc)
+		{
+			GetState().RpcBits += TotalBits;
+			INC_DWORD_STAT_BY(STAT_AlsNetworkStats_RpcBits, TotalBits)
+		}
+		else
+		{
+			GetState().PropertyBits += TotalBits;
+			INC_DWORD_STAT_BY(STAT_AlsNetworkStats_PropertyBits, TotalBits)
+		}
+
+#if CSV_PROFILER
+		FCsvProfiler::RecordCustomStat(Name, CSV_CATEGORY_INDEX(AlsNetwork), static_cast<int32>(TotalBits), ECsvCustomStatOp::Accumulate);
+#endif
+	}
+
+	void DumpEntries(FOutputDevice& Output, const TMap<FName, FEntry>& Entries, const double Duration)
+	{
+		auto SortedEntries{Entries.Array()};
+
+		SortedEntries.Sort([](const TPair<FName, FEntry>& A, const TPair<FName, FEntry>& B)
+		{
+			return A.Value.Bits > B.Value.Bits;
+		});
+
+		for (const auto& [Name, Entry] : SortedEntries)
+		{
+			Output.Logf(TEXT("    %-40s %10lld sends %12lld bits %12.1f bits/s"),
+			            *Name.ToString(), Entry.Count, Entry.Bits, Entry.Bits / Duration);
+		}
+	}
+
+	void Dump(FOutputDevice& Output)
+	{
+		const auto& State{GetState()};
+		const auto Duration{FMath::Max(FPlatformTime::Seconds() - State.StartTime, UE_DOUBLE_SMALL_NUMBER)};
+
+		Output.Logf(TEXT("ALS network stats for the last %.1f seconds:"), Duration);
+
+		for (const auto& [Actor, ActorStats] : State.Actors)
+		{
+			if (!ActorStats->Entries.IsEmpty())
+			{
+				Output.Logf(TEXT("  %s%s:"), *ActorStats->Name, Actor.ResolveObjectPtr() == nullptr ? TEXT(" [Destroyed]") : TEXT(""));
+				DumpEntries(Output, ActorStats->Entries, Duration);
+			}
+		}
+
+		Output.Logf(TEXT("  Total:"));
+		DumpEntries(Output, State.Aggregate, Duration);
+	}
+
+	void Reset()
+	{
+		auto& State{GetState()};
+
+		State.StartTime = FPlatformTime::Seconds();
+		State.Actors.Reset();
+		State.Aggregate.Reset();
+		State.PropertyBits = 0;
+		State.RpcBits = 0;
+	}
+
+	FAutoConsoleCommandWithOutputDevice DumpCommand{
+		TEXT("Als.NetworkStats.Dump"),
+		TEXT("Prints the estimated network cost of ALS replicated properties and RPCs per actor and in total."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&Dump)
+	};
+
+	FAutoConsoleCommand ResetCommand{
+		TEXT("Als.NetworkStats.Reset"),
+		TEXT("Resets the collected ALS network stats."),
+		FConsoleCommandDelegate::CreateStatic(&Reset)
+	};
+}
+
+void AlsNetworkStats::GetTotalBits(int64& PropertyBits, int64& RpcBits)
+{
+	const auto& State{GetState()};
+
+	PropertyBits = State.PropertyBits;
+	RpcBits = State.RpcBits;
+}
+
+bool AlsNetworkStats::IsEnabled()
+{
+	return CVarEnable.GetValueOnGameThread();
+}
+
+void AlsNetworkStats::RecordReplicatedProperties(const AActor* Actor, const UClass* OwnerClass)
+{
+	if (!IsEnabled() || !IsValid(Actor))
+	{
+		return;
+	}
+
+	auto& ActorStats{GetActorStats(Actor)};
+
+	if (!ActorStats.bSnapshotsInitialized)
+	{
+		ActorStats.bSnapshotsInitialized = true;
+
+		TArray<FLifetimeProperty> LifetimeProperties;
+		Actor->GetLifetimeReplicatedProps(LifetimeProperties);
+
+		for (TFieldIterator<FProperty> Iterator{Actor->GetClass()}; Iterator; ++Iterator)
+		{
+			if (!Iterator->HasAnyPropertyFlags(CPF_Net) || !Iterator->GetOwnerClass()->IsChildOf(OwnerClass))
+			{
+				continue;
+			}
+
+			auto& Snapshot{ActorStats.Snapshots.Emplace_GetRef()};
+			Snapshot.Property = *Iterator;
+			Snapshot.Value = Iterator->AllocateAndInitializeValue();
+
+			const auto* LifetimeProperty{
+				LifetimeProperties.FindByPredicate([RepIndex = Iterator->RepIndex](const FLifetimeProperty& Property)
+				{
+					return Property.RepIndex == RepIndex;
+				})
+			};
+
+			if (LifetimeProperty != nullptr)
+			{
+				Snapshot.Condition = LifetimeProperty->Condition;
+			}
+		}
+	}
+
+	for (auto& Snapshot : ActorStats.Snapshots)
+	{
+		auto* Value{Snapshot.Property->ContainerPtrToValuePtr<void>(const_cast<AActor*>(Actor))};
+
+		if (Snapshot.Property->Identical(Value, Snapshot.Value))
+		{
+			continue;
+		}
+
+		Snapshot.Property->CopyCompleteValue(Snapshot.Value, Value);
+
+		const auto ReceiversCount{
+			Snapshot.Condition == COND_OwnerOnly || Snapshot.Condition == COND_AutonomousOnly
+				? FMath::Min(1, CountReceivers(Actor, false))
+				: CountReceivers(Actor, Snapshot.Condition == COND_SkipOwner || Snapshot.Condition == COND_SimulatedOnly)
+		};
+
+		if (ReceiversCount > 0)
+		{
+			AddRecord(ActorStats, Snapshot.Property->GetFName(), CalculateValueBits(Snapshot.Property, Value), ReceiversCount, false);
+		}
+	}
+}
+
+void AlsNetworkStats::RecordRemoteFunction(const AActor* Actor, const UFunction* Function, void* Parameters, const UClass* OwnerClass)
+{
+	if (!IsEnabled() || !IsValid(Actor) || !IsValid(Function) || !Function->GetOwnerClass()->IsChildOf(OwnerClass))
+	{
+		return;
+	}
+
+	int32 ReceiversCount;
+
+	if (Function->HasAnyFunctionFlags(FUNC_NetMulticast))
+	{
+		ReceiversCount = CountReceivers(Actor, false);
+	}
+	else
+	{
+		const auto* NetDriver{Actor->GetNetDriver()};
+		ReceiversCount = IsValid(NetDriver) ? 1 : 0;
+	}
+
+	if (ReceiversCount <= 0)
+	{
+		return;
+	}
+
+	FNetBitWriter Writer{nullptr, 256};
+	Writer.SetAllowResize(true);
+
+	for (TFieldIterator<FProperty> Iterator{Function}; Iterator && Iterator->HasAnyPropertyFlags(CPF_Parm); ++Iterator)
+	{
+		if (!Iterator->HasAnyPropertyFlags(CPF_ReturnParm))
+		{
+			SerializeValue(Writer, *Iterator, Iterator->ContainerPtrToValuePtr<void>(Parameters));
+		}
+	}
+
+	AddRecord(GetActorStats(Actor), Function->GetFName(), Writer.GetNumBits(), ReceiversCount, true);
+}
@@ -2,8 +2,10 @@
 
 #include "Animation/AnimInstance.h"
 #include "Engine/World.h"
+#include "State/AlsCharacterSnapshot.h"
 #include "State/AlsControlRigInput.h"
 #include "State/AlsCrouchingState.h"
+#include "State/AlsDynamicMontageCache.h"
 #include "State/AlsDynamicTransitionsState.h"
 #include "State/AlsFeetState.h"
 #include "State/AlsGroundedState.h"
@@ -11,6 +13,7 @@
 #include "State/AlsLayeringState.h"
 #include "State/AlsLeanState.h"
 #include "State/AlsLocomotionAnimationState.h"
+#include "State/AlsLodState.h"
 #include "State/AlsLookState.h"
 #include "State/AlsMovementBaseState.h"
 #include "State/AlsPoseState.h"
@@ -21,6 +24,7 @@
 #include "State/AlsTransitionsState.h"
 #include "State/AlsTurnInPlaceState.h"
 #include "State/AlsViewAnimationState.h"
+#include "Utility/AlsDebugDrawBuffer.h"
 #include "Utility/AlsGameplayTags.h"
 #include "AlsAnimationInstance.generated.h"
 
@@ -41,11 +45,20 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	TObjectPtr<AAlsCharacter> Character;
 
+	// Copy of the character state taken at the beginning of the animation update.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsCharacterSnapshot CharacterSnapshot;
+
 	// Used to indicate that the animation instance has not been updated for a long time
 	// and its current state may not be correct (such as foot location used in foot lock).
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	uint8 bPendingUpdate : 1 {true};
 
+	// Indicates that only the state required by gameplay is updated. See
+	// FAlsGeneralAnimationSettings::bGameplayOnlyUpdateOnDedicatedServer for details.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	uint8 bGameplayOnlyUpdate : 1 {false};
+
 	// Time of the last teleportation event.
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ClampMin = 0))
 	double TeleportedTime{0.0f};
@@ -53,10 +66,16 @@ protected:
 #if WITH_EDITORONLY_DATA
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	uint8 bDisplayDebugTraces : 1 {false};
+#endif
 
-	mutable TArray<TFunction<void()>> DisplayDebugTracesQueue;
+#if WITH_EDITORONLY_DATA && ENABLE_DRAW_DEBUG
+	// Debug traces recorded on worker threads and drawn on the game thread in NativePostUpdateAnimation().
+	mutable FAlsDebugDrawBuffer DisplayDebugTracesBuffer;
 #endif
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsLodState LodState;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FGameplayTag ViewMode{AlsViewModeTags::ThirdPerson};
 
@@ -126,6 +145,10 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FAlsDynamicTransitionsState DynamicTransitionsState;
 
+	// Dynamic montages used by transitions and turn in place animations.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	TArray<FAlsDynamicMontageCacheEntry> DynamicMontagesCache;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FAlsRotateInPlaceState RotateInPlaceState;
 
@@ -163,7 +186,15 @@ public:
 
 	void MarkTeleported();
 
+	// Copies the animation state from another animation instance, so that the animation can continue without
+	// re-initialization after the character's animation instance class has been changed at runtime.
+	virtual void CopyStateFrom(const UAlsAnimationInstance* Other);
+
+protected:
+	virtual void RefreshLodOnGameThread();
+
 private:
+
 	void RefreshMovementBaseOnGameThread();
 
 	void RefreshLayering();
@@ -222,6 +253,8 @@ private:
 
 	void RefreshVelocityBlend();
 
+	bool ShouldRefreshLean(int32& SkippedUpdatesCount, float& SkippedDeltaTime, float& DeltaTime) const;
+
 	void RefreshGroundedLean();
 
 protected:
@@ -279,7 +312,11 @@ private:
 
 	void ProcessFootLockBaseChange(const FAlsFootUpdateContext& Context) const;
 
-	void RefreshFootLock(const FAlsFootUpdateContext& Context) const;
+	// Returns false if the foot lock is disabled for the foot.
+	bool RefreshFootLock(const FAlsFootUpdateContext& Context) const;
+
+	// Returns true if the foot lock has been constrained.
+	bool LimitFootLockAngle(const FAlsFootUpdateContext& Context) const;
 
 	// Transitions
 
@@ -313,6 +350,9 @@ private:
 
 	void StopQueuedTransitionAndTurnInPlaceAnimations();
 
+	UAnimMontage* PlaySlotAnimationAsCachedDynamicMontage(UAnimSequenceBase* Sequence, const FName& SlotName, float BlendInDuration,
+	                                                      float BlendOutDuration, float PlayRate, float StartTime = 0.0f);
+
 	// Rotate In Place
 
 public:
@@ -343,7 +383,14 @@ private:
 	void RefreshRagdollingOnGameThread();
 
 public:
-	FPoseSnapshot& SnapshotFinalRagdollPose();
+	// Saves the current ragdoll pose into a buffer that is bound to the mesh and reused across ragdoll get-ups. If
+	// bSimulatedBonesOnly is checked, only bones that have physics bodies are saved, while the rest keep the reference pose.
+	FPoseSnapshot& SnapshotFinalRagdollPose(bool bSimulatedBonesOnly = false);
+
+	int32 GetFinalRagdollPosePelvisBoneIndex() const;
+
+private:
+	bool BindFinalRagdollPose();
 
 	// Utility
 
@@ -390,3 +437,8 @@ inline void UAlsAnimationInstance::Jump()
 {
 	InAirState.bJumpRequested = true;
 }
+
+inline int32 UAlsAnimationInstance::GetFinalRagdollPosePelvisBoneIndex() const
+{
+	return RagdollingState.FinalRagdollPosePelvisBoneIndex;
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "GameFramework/Character.h"
+#include "Settings/AlsNetUpdateFrequencySettings.h"
+#include "State/AlsCharacterSnapshot.h"
 #include "State/AlsLocomotionState.h"
 #include "State/AlsMantlingState.h"
 #include "State/AlsMovementBaseState.h"
@@ -93,6 +95,11 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	uint8 bHasDesiredVelocity : 1 {false};
 
+	// Used instead of the reliable multicast if the initial velocity yaw angle is sent with the network move data.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient,
+		ReplicatedUsing = "OnReplicated_InitialVelocityYawAngle")
+	FAlsInitialVelocityYawAngle InitialVelocityYawAngle;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	FAlsLocomotionState LocomotionState;
 
@@ -108,6 +115,17 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	FAlsRollingState RollingState;
 
+	// Valid only on the server if the adaptive net update frequency is enabled.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
+	EAlsNetUpdateState NetUpdateState{EAlsNetUpdateState::Idle};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient, Meta = (ForceUnits = "Hz"))
+	float AdaptiveNetUpdateFrequency{0.0f};
+
+	// Filled at the end of each tick and consumed by the animation instance.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
+	FAlsCharacterSnapshot Snapshot;
+
 	FTimerHandle BrakingFrictionFactorResetTimer;
 
 public:
@@ -119,6 +137,10 @@ public:
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+
+	virtual bool CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack) override;
+
 	virtual void PreRegisterAllComponents() override;
 
 	virtual void PostRegisterAllComponents() override;
@@ -144,6 +166,12 @@ public:
 public:
 	const UAlsCharacterSettings* GetSettings() const;
 
+	// Replaces the animation instance of the mesh, for example, with a lightweight crowd animation instance when the
+	// character becomes insignificant, and carries the animation state over to the new animation instance. Montages
+	// and linked animation layers of the previous animation instance are not carried over.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Character")
+	void SetAnimationInstanceClass(TSubclassOf<UAlsAnimationInstance> NewAnimationInstanceClass);
+
 protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "Als Character", Meta = (ReturnDisplayName = "Handled"))
 	bool OnCalculateCamera(float DeltaTime, FMinimalViewInfo& ViewInfo);
@@ -409,6 +437,16 @@ private:
 	UFUNCTION(NetMulticast, Reliable)
 	void MulticastSetInitialVelocityYawAngle(float NewVelocityYawAngle);
 
+public:
+	// Called on the server when the initial velocity yaw angle is received with the network move data.
+	void SetInitialVelocityYawAngle(float NewVelocityYawAngle);
+
+private:
+	UFUNCTION()
+	void OnReplicated_InitialVelocityYawAngle();
+
+	void ApplyInitialVelocityYawAngle(float NewVelocityYawAngle);
+
 	// Jumping
 
 public:
@@ -590,6 +628,25 @@ private:
 
 	void ConstraintRagdollSpeed() const;
 
+	// Net Update Frequency
+
+public:
+	EAlsNetUpdateState GetNetUpdateState() const;
+
+private:
+	EAlsNetUpdateState CalculateNetUpdateState() const;
+
+	void RefreshNetUpdateFrequency(float DeltaTime);
+
+	void ForceNetUpdateOnStateChange();
+
+	// Snapshot
+
+public:
+	const FAlsCharacterSnapshot& GetSnapshot() const;
+
+	void RefreshSnapshot();
+
 	// Debug
 
 public:
@@ -689,3 +746,13 @@ inline const FAlsRagdollingState& AAlsCharacter::GetRagdollingState() const
 {
 	return RagdollingState;
 }
+
+inline EAlsNetUpdateState AAlsCharacter::GetNetUpdateState() const
+{
+	return NetUpdateState;
+}
+
+inline const FAlsCharacterSnapshot& AAlsCharacter::GetSnapshot() const
+{
+	return Snapshot;
+}
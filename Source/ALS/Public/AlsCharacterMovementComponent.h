@@ -18,6 +18,10 @@ public:
 
 	FGameplayTag MaxAllowedGait{AlsGaitTags::Running};
 
+	uint8 bInitialVelocityYawAngleValid : 1 {false};
+
+	float InitialVelocityYawAngle{0.0f};
+
 public:
 	virtual void ClientFillNetworkMoveData(const FSavedMove_Character& Move, ENetworkMoveType MoveType) override;
 
@@ -45,6 +49,10 @@ public:
 
 	FGameplayTag MaxAllowedGait{AlsGaitTags::Running};
 
+	uint8 bInitialVelocityYawAngleValid : 1 {false};
+
+	float InitialVelocityYawAngle{0.0f};
+
 public:
 	virtual void Clear() override;
 
@@ -53,6 +61,8 @@ public:
 
 	virtual bool CanCombineWith(const FSavedMovePtr& NewMovePtr, ACharacter* Character, float MaxDeltaTime) const override;
 
+	virtual bool IsImportantMove(const FSavedMovePtr& LastAckedMove) const override;
+
 	virtual void CombineWith(const FSavedMove_Character* PreviousMove, ACharacter* Character,
 	                         APlayerController* Player, const FVector& PreviousStartLocation) override;
 
@@ -70,6 +80,33 @@ public:
 	virtual FSavedMovePtr AllocateNewMove() override;
 };
 
+#if WITH_DEV_AUTOMATION_TESTS
+// Network movement counters of a single character, complementing the global counters in the Als stats group,
+// so that automation tests can check what each character has sent and received.
+struct ALS_API FAlsMovementNetworkCounters
+{
+	// Server side.
+
+	int32 ServerMovesCount{0};
+
+	int32 ServerCorrectionsCount{0};
+
+	uint64 ServerMovesCycles{0};
+
+	int32 ReceivedInitialVelocityYawAnglesCount{0};
+
+	float LastReceivedInitialVelocityYawAngle{0.0f};
+
+	// Client side.
+
+	int32 CombinedMovesCount{0};
+
+	int32 SentInitialVelocityYawAnglesCount{0};
+
+	float LastSentInitialVelocityYawAngle{0.0f};
+};
+#endif
+
 UCLASS(ClassGroup = "ALS")
 class ALS_API UAlsCharacterMovementComponent : public UCharacterMovementComponent
 {
@@ -124,6 +161,17 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	uint8 bPrePenetrationAdjustmentVelocityValid : 1 {false};
 
+	// Valid only on the autonomous proxy. Consumed by the next saved move and sent to the server with it.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	uint8 bPendingInitialVelocityYawAngleValid : 1 {false};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
+	float PendingInitialVelocityYawAngle{0.0f};
+
+#if WITH_DEV_AUTOMATION_TESTS
+	FAlsMovementNetworkCounters NetworkCounters;
+#endif
+
 public:
 	FAlsPhysicsRotationDelegate OnPhysicsRotation;
 
@@ -184,6 +232,11 @@ protected:
 
 	virtual void MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAcceleration) override;
 
+public:
+	virtual bool ServerCheckClientError(float ClientTimeStamp, float DeltaTime, const FVector& Acceleration,
+	                                    const FVector& ClientLocation, const FVector& RelativeClientLocation,
+	                                    UPrimitiveComponent* ClientMovementBase, FName ClientBaseBoneName, uint8 ClientMovementMode) override;
+
 public:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Character Movement")
 	void SetMovementSettings(UAlsMovementSettings* NewMovementSettings);
@@ -219,6 +272,14 @@ public:
 	void SetInputBlocked(bool bNewInputBlocked);
 
 	bool TryConsumePrePenetrationAdjustmentVelocity(FVector& OutVelocity);
+
+	void SetPendingInitialVelocityYawAngle(float NewVelocityYawAngle);
+
+#if WITH_DEV_AUTOMATION_TESTS
+	const FAlsMovementNetworkCounters& GetNetworkCounters() const;
+
+	void ResetNetworkCounters();
+#endif
 };
 
 inline const FAlsMovementGaitSettings& UAlsCharacterMovementComponent::GetGaitSettings() const
@@ -250,3 +311,21 @@ inline float UAlsCharacterMovementComponent::GetGaitAmount() const
 {
 	return GaitAmount;
 }
+
+inline void UAlsCharacterMovementComponent::SetPendingInitialVelocityYawAngle(const float NewVelocityYawAngle)
+{
+	bPendingInitialVelocityYawAngleValid = true;
+	PendingInitialVelocityYawAngle = NewVelocityYawAngle;
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+inline const FAlsMovementNetworkCounters& UAlsCharacterMovementComponent::GetNetworkCounters() const
+{
+	return NetworkCounters;
+}
+
+inline void UAlsCharacterMovementComponent::ResetNetworkCounters()
+{
+	NetworkCounters = {};
+}
+#endif
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "AlsAnimationInstance.h"
+#include "AlsCrowdAnimationInstance.generated.h"
+
+// Lightweight animation instance intended for crowds and distant characters. Feet, transitions, dynamic transitions,
+// look and layering are never refreshed, and the lean is refreshed less frequently. The animation blueprint based
+// on this class is expected to not use these features. Use AAlsCharacter::SetAnimationInstanceClass() to switch
+// between this and the regular animation instance at runtime, for example, depending on the character significance.
+UCLASS()
+class ALS_API UAlsCrowdAnimationInstance : public UAlsAnimationInstance
+{
+	GENERATED_BODY()
+
+protected:
+	// The lean is refreshed only once per this number of animation updates. A value of 1 means every update.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 1))
+	int32 LeanUpdateInterval{4};
+
+protected:
+	virtual void RefreshLodOnGameThread() override;
+};
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "GameFramework/Actor.h"
+#include "AlsMantlingLedgeIndex.generated.h"
+
+class UAlsCharacterSettings;
+
+USTRUCT()
+struct ALS_API FAlsMantlingLedge
+{
+	GENERATED_BODY()
+
+	// World location of the ledge edge, Z is the height of the walkable surface on top of the ledge.
+	UPROPERTY(VisibleAnywhere, Category = "ALS")
+	FVector3f Location{ForceInit};
+
+	// Horizontal direction pointing away from the ledge, i.e. towards the side the character mantles from.
+	UPROPERTY(VisibleAnywhere, Category = "ALS")
+	FVector2f Normal{ForceInit};
+};
+
+// Baked set of mantleable ledges extracted from static collision. Ledges are stored in a flat array sorted
+// by a 2D grid cell key, so a query around the character costs one binary search per grid row it touches.
+// Used by the character to confirm that there is a ledge nearby before performing the in-air mantling traces.
+UCLASS(NotBlueprintable, HideCategories = ("Rendering", "Replication", "Collision", "Input", "HLOD", "Physics", "Networking"))
+class ALS_API AAlsMantlingLedgeIndex : public AActor
+{
+	GENERATED_BODY()
+
+protected:
+	// Half size of the box around the actor's location that will be scanned for ledges.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	FVector BakeExtent{5000.0f, 5000.0f, 2000.0f};
+
+	// Distance between vertical sample traces. Smaller values find more ledges at the cost of bake time.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 1, ForceUnits = "cm"))
+	float SampleSpacing{50.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 1, ForceUnits = "cm"))
+	float CellSize{200.0f};
+
+	// The mantling trace channel, responses, ledge heights and slope angle threshold of these
+	// settings are used for baking, so that the baked ledges match the runtime mantling traces.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	TObjectPtr<UAlsCharacterSettings> CharacterSettings;
+
+	UPROPERTY(VisibleAnywhere, Category = "State")
+	FBox BakedBounds{ForceInit};
+
+	UPROPERTY(VisibleAnywhere, Category = "State")
+	float BakedCellSize{200.0f};
+
+	UPROPERTY(VisibleAnywhere, Category = "State")
+	float BakedSampleSpacing{50.0f};
+
+	UPROPERTY(VisibleAnywhere, Category = "State")
+	TArray<FAlsMantlingLedge> Ledges;
+
+public:
+	AAlsMantlingLedgeIndex();
+
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+
+#if WITH_EDITOR
+	// Rebuilds the ledge list from the static collision inside the bake extent.
+	UFUNCTION(CallInEditor, Category = "Settings")
+	void BakeLedges();
+#endif
+
+	// Returns true if the whole query box is inside the baked bounds, i.e. the baked ledges can be used to answer the query.
+	bool IsInsideBakedBounds(const FBox& QueryBox) const;
+
+	// Returns true if there is at least one ledge within the horizontal radius around the location whose
+	// height relative to the location is inside the height range and whose normal faces against the direction.
+	bool HasLedgeNear(const FVector& Location, float Radius, const FVector2f& HeightRange, const FVector& Direction) const;
+
+	int32 GetLedgesNum() const;
+
+private:
+	static uint64 MakeCellKey(int32 CellX, int32 CellY);
+
+	uint64 CalculateCellKey(const FVector3f& Location) const;
+};
+
+inline bool AAlsMantlingLedgeIndex::IsInsideBakedBounds(const FBox& QueryBox) const
+{
+	return BakedBounds.IsValid && BakedBounds.IsInside(QueryBox);
+}
+
+inline int32 AAlsMantlingLedgeIndex::GetLedgesNum() const
+{
+	return Ledges.Num();
+}
+
+inline uint64 AAlsMantlingLedgeIndex::MakeCellKey(const int32 CellX, const int32 CellY)
+{
+	// Flipping the sign bit keeps the unsigned ordering consistent with the signed cell coordinates.
+
+	return static_cast<uint64>(static_cast<uint32>(CellY) ^ 0x80000000u) << 32 |
+	       static_cast<uint64>(static_cast<uint32>(CellX) ^ 0x80000000u);
+}
+
+inline uint64 AAlsMantlingLedgeIndex::CalculateCellKey(const FVector3f& Location) const
+{
+	return MakeCellKey(FMath::FloorToInt32(Location.X / BakedCellSize), FMath::FloorToInt32(Location.Y / BakedCellSize));
+}
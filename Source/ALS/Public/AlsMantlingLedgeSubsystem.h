@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsMantlingLedgeSubsystem.generated.h"
+
+class AAlsMantlingLedgeIndex;
+
+UENUM()
+enum class EAlsMantlingLedgeQueryResult : uint8
+{
+	// The location is not covered by any baked index, the caller should fall back to the regular traces.
+	NotBaked,
+	NoLedge,
+	LedgeFound
+};
+
+// Keeps track of the mantling ledge indices of all loaded levels.
+UCLASS()
+class ALS_API UAlsMantlingLedgeSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AAlsMantlingLedgeIndex>> Indices;
+
+public:
+	void RegisterIndex(AAlsMantlingLedgeIndex* Index);
+
+	void UnregisterIndex(AAlsMantlingLedgeIndex* Index);
+
+	bool HasIndices() const;
+
+	EAlsMantlingLedgeQueryResult QueryLedge(const FVector& Location, float Radius,
+	                                        const FVector2f& HeightRange, const FVector& Direction) const;
+};
+
+inline bool UAlsMantlingLedgeSubsystem::HasIndices() const
+{
+	return !Indices.IsEmpty();
+}
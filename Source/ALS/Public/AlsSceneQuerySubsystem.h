@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include <atomic>
+#include "AlsSceneQuerySubsystem.generated.h"
+
+UENUM()
+enum class EAlsSceneQueryCategory : uint8
+{
+	Mantling,
+	GroundPrediction,
+	Ragdolling,
+	Footsteps,
+	FootOffset,
+	Floor,
+	Camera
+};
+
+UENUM()
+enum class EAlsSceneQueryPriority : uint8
+{
+	// Queries of the local player's pawn or view target. These queries are never deferred.
+	LocalPlayer,
+	Nearby,
+	Distant
+};
+
+// Keeps track of the number of ALS scene queries performed in the world each frame and enforces the per-frame budget
+// set by the Als.SceneQueries.FrameBudget console variable. Low priority queries that exceed the budget are deferred,
+// and the caller should reuse its previous result instead. Query counts by category are available in the Als stat group.
+UCLASS()
+class ALS_API UAlsSceneQuerySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+	FDelegateHandle WorldTickStartHandle;
+
+	// Snapshot of the player controllers' pawns, view targets and view locations, taken at the start of each world
+	// tick, so that the query priority can be calculated from any thread. The actors are only used for comparison.
+
+	TArray<const AActor*, TInlineAllocator<4>> LocalPlayerActors;
+
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+
+	std::atomic<int32> FrameQueriesCount{0};
+
+public:
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+private:
+	void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaTime);
+
+public:
+	int32 GetFrameQueriesCount() const;
+
+	// Thread safe. Returns the priority of queries performed by the specified actor at the specified location.
+	EAlsSceneQueryPriority CalculatePriority(const AActor* Actor, const FVector& Location) const;
+
+	// Thread safe. Returns true if the queries can be performed this frame. Otherwise, the caller should reuse its
+	// previous result. If a deferred frames counter is specified, the queries are never deferred more than the
+	// number of frames set by the Als.SceneQueries.MaxDeferredFramesCount console variable in a row.
+	bool TryAcquireQueries(EAlsSceneQueryCategory Category, EAlsSceneQueryPriority Priority,
+	                       int32* DeferredFramesCount = nullptr, int32 QueriesCount = 1);
+
+	// Thread safe. Records queries that cannot be deferred, so that they are still reported and counted toward the budget.
+	void RecordQueries(EAlsSceneQueryCategory Category, int32 QueriesCount = 1);
+
+	// Same as TryAcquireQueries(), but also calculates the priority. Always returns true if the world has no subsystem.
+	static bool TryAcquireQueriesInWorld(const UWorld* World, const AActor* Actor, const FVector& Location,
+	                                     EAlsSceneQueryCategory Category, int32* DeferredFramesCount = nullptr,
+	                                     int32 QueriesCount = 1);
+
+	static void RecordQueriesInWorld(const UWorld* World, EAlsSceneQueryCategory Category, int32 QueriesCount = 1);
+};
+
+inline int32 UAlsSceneQuerySubsystem::GetFrameQueriesCount() const
+{
+	return FrameQueriesCount.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Components/SkeletalMeshComponent.h"
+#include "AlsSkeletalMeshComponent.generated.h"
+
+class ACharacter;
+
+UCLASS(ClassGroup = "ALS", Meta = (BlueprintSpawnableComponent))
+class ALS_API UAlsSkeletalMeshComponent : public USkeletalMeshComponent
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	TObjectPtr<ACharacter> Character;
+
+public:
+	virtual void OnRegister() override;
+
+	virtual void TickAnimation(float DeltaTime, bool bNeedsValidRootMotion) override;
+
+private:
+	void SynchronizeAbsoluteRotation();
+};
@@ -39,6 +39,10 @@ public:
 	UPROPERTY(Transient, Meta = (Output))
 	FVector OffsetNormal{ForceInit};
 
+	// Number of executions in a row for which the trace was deferred by the scene query subsystem.
+	UPROPERTY(Transient)
+	int32 DeferredQueriesCount{0};
+
 public:
 	RIGVM_METHOD()
 	virtual void Execute() override;
@@ -2,6 +2,7 @@
 
 #include "AlsInAirRotationMode.h"
 #include "AlsMantlingSettings.h"
+#include "AlsNetUpdateFrequencySettings.h"
 #include "AlsRagdollingSettings.h"
 #include "AlsRollingSettings.h"
 #include "AlsViewSettings.h"
@@ -46,6 +47,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	uint8 bAutoRotateOnAnyInputWhileNotMovingInViewDirectionRotationMode : 1 {true};
 
+	// If checked, the initial velocity yaw angle will be sent to the server inside the network move data and then replicated
+	// to simulated proxies as a regular property, instead of being sent through reliable server and multicast RPCs.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	uint8 bSendInitialVelocityYawAngleWithMoveData : 1 {false};
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FAlsViewSettings View;
 
@@ -58,6 +64,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FAlsRollingSettings Rolling;
 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsNetUpdateFrequencySettings NetUpdateFrequency;
+
 public:
 	UAlsCharacterSettings();
 
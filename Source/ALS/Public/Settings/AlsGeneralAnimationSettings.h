@@ -13,6 +13,14 @@ struct ALS_API FAlsGeneralAnimationSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	uint8 bUseFootIkBones : 1 {true};
 
+	// If checked, on dedicated servers the animation instance will only update the state required by gameplay, such
+	// as animation curves, montages, rotate in place and turn in place, and will skip purely visual features such as foot
+	// lock, look, lean, dynamic transitions and ground prediction. The character also stops refreshing the mesh bones there
+	// (except while ragdolling), even if the mesh's default visibility based anim tick option is set to always refresh them,
+	// so don't check this if the server relies on up-to-date bone transforms, for example for per-bone hit detection.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bGameplayOnlyUpdateOnDedicatedServer : 1 {false};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm/s"))
 	float MovingSmoothSpeedThreshold{150.0f};
 
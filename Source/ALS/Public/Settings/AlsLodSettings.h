@@ -0,0 +1,53 @@
+#pragma once
+
+#include "AlsLodSettings.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsLodFeatureSettings
+{
+	GENERATED_BODY()
+
+	// These settings are used when the predicted mesh LOD is greater than or equal to this value.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 MinLod{2};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bDisableFootLock : 1 {true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bDisableDynamicTransitions : 1 {true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bDisableTransitions : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bDisableLook : 1 {true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bDisableRotateInPlace : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bDisableTurnInPlace : 1 {false};
+
+	// The lean is updated only once per this number of animation updates. A value of 1 means every update.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 1))
+	int32 LeanUpdateInterval{2};
+};
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsLodSettings
+{
+	GENERATED_BODY()
+
+	// If checked, some animation instance features will be disabled or updated less frequently at higher mesh LODs.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bEnableLodFeatures : 1 {false};
+
+	// The entry with the highest minimum LOD that does not exceed the predicted
+	// mesh LOD is used. If there is no such entry, all features are enabled.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (EditCondition = "bEnableLodFeatures"))
+	TArray<FAlsLodFeatureSettings> Features{FAlsLodFeatureSettings{}};
+
+public:
+	const FAlsLodFeatureSettings* FindFeatures(int32 LodLevel) const;
+};
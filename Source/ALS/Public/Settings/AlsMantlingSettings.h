@@ -134,6 +134,15 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "ALS", AdvancedDisplay)
 	FCollisionResponseContainer MantlingTraceResponses{ECR_Ignore};
 
+	// If checked, baked mantling ledge indices are used to reduce how often the in-air mantling performs its traces.
+	// A baked ledge near the character lets the traces run immediately. Otherwise, they only run once per the
+	// specified number of attempts, because the bake can miss thin or movable geometry. Grounded mantling always traces.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bUseBakedLedges : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 1, EditCondition = "bUseBakedLedges"))
+	int32 BakedLedgesInAirTraceInterval{4};
+
 	// Used when the mantling was interrupted and we need to stop the animation.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
 	float BlendOutDuration{0.3f};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "AlsNetUpdateFrequencySettings.generated.h"
+
+UENUM(BlueprintType)
+enum class EAlsNetUpdateState : uint8
+{
+	Idle,
+	Moving,
+	Sprinting,
+	InAir,
+	LocomotionAction,
+	Ragdolling,
+	RagdollingSettled
+};
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsNetUpdateFrequencySettings
+{
+	GENERATED_BODY()
+
+	// If checked, the server will adjust the actor's net update frequency depending on what the character is currently doing.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bEnableAdaptiveNetUpdateFrequency : 1 {false};
+
+	// If checked, the actor will be replicated immediately when the locomotion mode, locomotion action, stance or gait changes.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (EditCondition = "bEnableAdaptiveNetUpdateFrequency"))
+	uint8 bForceNetUpdateOnStateChange : 1 {true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 1, EditCondition = "bEnableAdaptiveNetUpdateFrequency", ForceUnits = "Hz"))
+	FVector2f NetUpdateFrequencyRange{5.0f, 100.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 1, EditCondition = "bEnableAdaptiveNetUpdateFrequency", ForceUnits = "Hz"))
+	float IdleNetUpdateFrequency{10.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 1, EditCondition = "bEnableAdaptiveNetUpdateFrequency", ForceUnits = "Hz"))
+	float MovingNetUpdateFrequency{30.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 1, EditCondition = "bEnableAdaptiveNetUpdateFrequency", ForceUnits = "Hz"))
+	float SprintingNetUpdateFrequency{45.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 1, EditCondition = "bEnableAdaptiveNetUpdateFrequency", ForceUnits = "Hz"))
+	float InAirNetUpdateFrequency{60.0f};
+
+	// Used while mantling, rolling, or performing any other locomotion action except ragdolling.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 1, EditCondition = "bEnableAdaptiveNetUpdateFrequency", ForceUnits = "Hz"))
+	float LocomotionActionNetUpdateFrequency{100.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 1, EditCondition = "bEnableAdaptiveNetUpdateFrequency", ForceUnits = "Hz"))
+	float RagdollingNetUpdateFrequency{60.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 1, EditCondition = "bEnableAdaptiveNetUpdateFrequency", ForceUnits = "Hz"))
+	float RagdollingSettledNetUpdateFrequency{5.0f};
+
+	// The ragdoll is considered settled when its speed is less than this value.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bEnableAdaptiveNetUpdateFrequency", ForceUnits = "cm/s"))
+	float RagdollingSettledSpeedThreshold{10.0f};
+
+	// If the view yaw speed exceeds this value, the net update frequency will be raised to at least the fast view rotation frequency.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bEnableAdaptiveNetUpdateFrequency", ForceUnits = "deg/s"))
+	float FastViewYawSpeedThreshold{90.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 1, EditCondition = "bEnableAdaptiveNetUpdateFrequency", ForceUnits = "Hz"))
+	float FastViewRotationNetUpdateFrequency{30.0f};
+
+	// The net update frequency is raised instantly, but lowered gradually at this rate to avoid flickering between states.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bEnableAdaptiveNetUpdateFrequency"))
+	float NetUpdateFrequencyDecreaseRate{50.0f};
+};
@@ -24,6 +24,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	uint8 bLimitInitialRagdollSpeed : 1 {true};
 
+	// If checked, only bones that have physics bodies will be saved in the final ragdoll pose used to blend
+	// out of the ragdoll, and the rest of the bones will use the reference pose. This makes stopping the
+	// ragdoll cheaper, but is only suitable if the get-up animations cover the remaining bones anyway.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bSnapshotOnlySimulatedBones : 1 {false};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TObjectPtr<UAnimMontage> GetUpFrontMontage;
 
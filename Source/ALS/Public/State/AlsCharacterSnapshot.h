@@ -0,0 +1,118 @@
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "AlsCharacterSnapshot.generated.h"
+
+class UPrimitiveComponent;
+
+// Flat copy of the character state required by the animation instance. It is filled once at the end of the
+// character tick, so the animation instance can take everything it needs with a single copy, instead of
+// querying the character, its movement component and capsule during the game thread part of the animation update.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsCharacterSnapshot
+{
+	GENERATED_BODY()
+
+	// Value of GFrameCounter at the moment the snapshot was taken.
+	uint64 FrameNumber{0};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	FGameplayTag ViewMode;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	FGameplayTag LocomotionMode;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	FGameplayTag RotationMode;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	FGameplayTag Stance;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	FGameplayTag Gait;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	FGameplayTag OverlayMode;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	FGameplayTag LocomotionAction;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	TObjectPtr<UPrimitiveComponent> MovementBasePrimitive;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	FName MovementBaseBoneName;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	uint8 bMovementBaseHasRelativeLocation : 1 {false};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	uint8 bMovementBaseHasRelativeRotation : 1 {false};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	uint8 bHasInput : 1 {false};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	uint8 bHasVelocity : 1 {false};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	uint8 bMoving : 1 {false};
+
+	// Indicates that the mesh is smoothed by the network smoothing and its transform may differ from the actor transform.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	uint8 bNetworkSmoothingActive : 1 {false};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	FVector MovementBaseLocation{ForceInit};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	FQuat MovementBaseRotation{ForceInit};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	FRotator ViewRotation{ForceInit};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ForceUnits = "deg/s"))
+	float ViewYawSpeed{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
+	float InputYawAngle{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm/s"))
+	float Speed{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	FVector Velocity{ForceInit};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
+	float VelocityYawAngle{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
+	float TargetYawAngle{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm/s^2"))
+	float MaxAcceleration{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm/s^2"))
+	float MaxBrakingDeceleration{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = -1, ClampMax = 1))
+	float WalkableFloorAngleCos{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float CapsuleRadius{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float CapsuleHalfHeight{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm/s"))
+	float RagdollingSpeed{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0))
+	float CustomTimeDilation{1.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	FVector BaseTranslationOffset{ForceInit};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	FQuat BaseRotationOffset{ForceInit};
+};
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "AlsDynamicMontageCache.generated.h"
+
+class UAnimMontage;
+class UAnimSequenceBase;
+
+// Dynamic montages created from the same sequence with the same slot and blend settings are identical,
+// so they can be created once and then reused instead of creating a new montage each time an animation is played.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsDynamicMontageCacheEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	TObjectPtr<UAnimSequenceBase> Sequence;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	FName SlotName;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float BlendInDuration{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float BlendOutDuration{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	TObjectPtr<UAnimMontage> Montage;
+};
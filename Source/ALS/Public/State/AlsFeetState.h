@@ -79,6 +79,9 @@ struct ALS_API FAlsFootUpdateContext
 
 	FTransform ComponentTransformInverse;
 
+	// Valid only if the movement base has a relative location.
+	FQuat MovementBaseRotationInverse{ForceInit};
+
 	FAlsFootState* FootState{nullptr};
 
 	float IkAmount{0.0f};
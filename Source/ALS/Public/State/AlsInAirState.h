@@ -21,4 +21,8 @@ struct ALS_API FAlsInAirState
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 1))
 	float GroundPredictionAmount{1.0f};
+
+	// Number of frames in a row for which the scene queries were deferred by the scene query subsystem.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 DeferredQueriesCount{0};
 };
@@ -51,3 +51,16 @@ struct ALS_API FAlsLocomotionState
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	uint8 bResetAimingLimit : 1 {true};
 };
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsInitialVelocityYawAngle
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
+	float YawAngle{0.0f};
+
+	// Incremented every time the character starts moving, so that the same angle is still replicated again.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 Counter{0};
+};
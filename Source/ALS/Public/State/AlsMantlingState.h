@@ -9,4 +9,12 @@ struct ALS_API FAlsMantlingState
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	int32 RootMotionSourceId{0};
+
+	// Number of in-air mantling attempts in a row whose traces were skipped because there were no baked ledges nearby.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 BakedLedgesSkippedTracesCount{0};
+
+	// Number of frames in a row for which the scene queries were deferred by the scene query subsystem.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 DeferredQueriesCount{0};
 };
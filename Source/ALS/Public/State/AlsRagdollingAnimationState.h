@@ -3,14 +3,38 @@
 #include "Animation/PoseSnapshot.h"
 #include "AlsRagdollingAnimationState.generated.h"
 
+class UPhysicsAsset;
+class USkinnedAsset;
+
 USTRUCT(BlueprintType)
 struct ALS_API FAlsRagdollingAnimationState
 {
 	GENERATED_BODY()
 
+	// Pre-sized for the skinned asset below and reused across ragdoll get-ups.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FPoseSnapshot FinalRagdollPose;
 
+	// Skinned asset and physics asset to which the final ragdoll pose and the cached bone indices below are bound.
+
+	TWeakObjectPtr<const USkinnedAsset> FinalRagdollPoseSkinnedAsset;
+
+	TWeakObjectPtr<const UPhysicsAsset> FinalRagdollPosePhysicsAsset;
+
+	TArray<int32> FinalRagdollPoseParentBoneIndices;
+
+	// Sorted indices of bones that have physics bodies, excluding the root bone.
+	TArray<int32> FinalRagdollPoseSimulatedBoneIndices;
+
+	// For each simulated bone above, the index of its nearest simulated ancestor, or the root bone if there is none.
+	TArray<int32> FinalRagdollPoseSimulatedAncestorBoneIndices;
+
+	// For each simulated bone above, the reference pose transform of its parent relative to its nearest simulated
+	// ancestor, i.e. the reference pose local transforms of the non-simulated bones between them combined together.
+	TArray<FTransform> FinalRagdollPoseSimulatedParentOffsets;
+
+	int32 FinalRagdollPosePelvisBoneIndex{INDEX_NONE};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 1, ForceUnits = "x"))
 	float FlailPlayRate{1.0f};
 };
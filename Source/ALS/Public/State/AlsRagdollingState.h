@@ -18,4 +18,8 @@ struct ALS_API FAlsRagdollingState
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm/s"))
 	float SpeedLimit{0.0f};
+
+	// Number of frames in a row for which the scene queries were deferred by the scene query subsystem.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 DeferredQueriesCount{0};
 };
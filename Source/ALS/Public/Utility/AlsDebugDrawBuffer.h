@@ -0,0 +1,63 @@
+#pragma once
+
+#if ENABLE_DRAW_DEBUG
+
+#include <atomic>
+
+struct FHitResult;
+
+// Plain data of a single deferred capsule sweep debug draw call, so that it can be recorded without any heap allocations.
+struct ALS_API FAlsDebugDrawCommand
+{
+	uint8 bHit : 1 {false};
+
+	FVector Start{ForceInit};
+
+	FVector End{ForceInit};
+
+	FRotator Rotation{ForceInit};
+
+	FVector HitLocation{ForceInit};
+
+	FVector HitImpactPoint{ForceInit};
+
+	float Radius{0.0f};
+
+	float HalfHeight{0.0f};
+
+	FLinearColor Color{ForceInit};
+
+	FLinearColor HitColor{ForceInit};
+};
+
+// Fixed capacity buffer of debug draw commands. Commands can be added from any thread and are drawn later on the game
+// thread, since debug drawing is not thread-safe. Commands that do not fit into the buffer are dropped until the next flush.
+class ALS_API FAlsDebugDrawBuffer
+{
+public:
+	// The buffer is flushed after every animation update, and the only worker thread debug draw is the single ground
+	// prediction sweep of UAlsAnimationInstance::RefreshGroundPrediction(), so there is no need for more commands.
+	static constexpr auto Capacity{1};
+
+private:
+	TStaticArray<FAlsDebugDrawCommand, Capacity> Commands;
+
+	std::atomic<int32> CommandsCount{0};
+
+public:
+	FAlsDebugDrawBuffer() = default;
+
+	FAlsDebugDrawBuffer(const FAlsDebugDrawBuffer&) = delete;
+
+	FAlsDebugDrawBuffer& operator=(const FAlsDebugDrawBuffer&) = delete;
+
+	void AddSweepCapsule(const FVector& Start, const FVector& End, const FRotator& Rotation, float Radius, float HalfHeight,
+	                     bool bHit, const FHitResult& Hit, const FLinearColor& SweepColor, const FLinearColor& HitColor);
+
+	// Draws all recorded commands and resets the buffer. Must be called on the game thread.
+	void Flush(const UObject* WorldContext);
+
+	void Reset();
+};
+
+#endif
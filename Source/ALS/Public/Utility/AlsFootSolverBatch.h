@@ -0,0 +1,64 @@
+#pragma once
+
+// Structure-of-arrays batch of foot transforms, in which each component of the locations and rotations of up to
+// four feet is stored in its own lane of a vector register, so that all feet are processed by the same instructions.
+struct ALS_API FAlsFootSolverBatch
+{
+	static constexpr auto LanesCount{4};
+
+	alignas(32) double LocationX[LanesCount]{};
+
+	alignas(32) double LocationY[LanesCount]{};
+
+	alignas(32) double LocationZ[LanesCount]{};
+
+	alignas(32) double RotationX[LanesCount]{};
+
+	alignas(32) double RotationY[LanesCount]{};
+
+	alignas(32) double RotationZ[LanesCount]{};
+
+	alignas(32) double RotationW[LanesCount]{1.0, 1.0, 1.0, 1.0};
+
+public:
+	void Set(int32 Index, const FVector& Location, const FQuat& Rotation);
+
+	FVector GetLocation(int32 Index) const;
+
+	FQuat GetRotation(int32 Index) const;
+
+	// Same as calling FTransform::TransformPosition() and FTransform::TransformRotation() for each lane.
+	void TransformBy(const FTransform& Transform);
+
+	// Same as calling FMath::Lerp() for locations and FQuat::FastLerp() followed by FQuat::Normalize() for rotations for each lane.
+	static void Blend(const FAlsFootSolverBatch& From, const FAlsFootSolverBatch& To,
+	                  const double (&Alphas)[LanesCount], FAlsFootSolverBatch& Result);
+};
+
+inline void FAlsFootSolverBatch::Set(const int32 Index, const FVector& Location, const FQuat& Rotation)
+{
+	check(Index >= 0 && Index < LanesCount)
+
+	LocationX[Index] = Location.X;
+	LocationY[Index] = Location.Y;
+	LocationZ[Index] = Location.Z;
+
+	RotationX[Index] = Rotation.X;
+	RotationY[Index] = Rotation.Y;
+	RotationZ[Index] = Rotation.Z;
+	RotationW[Index] = Rotation.W;
+}
+
+inline FVector FAlsFootSolverBatch::GetLocation(const int32 Index) const
+{
+	check(Index >= 0 && Index < LanesCount)
+
+	return {LocationX[Index], LocationY[Index], LocationZ[Index]};
+}
+
+inline FQuat FAlsFootSolverBatch::GetRotation(const int32 Index) const
+{
+	check(Index >= 0 && Index < LanesCount)
+
+	return {RotationX[Index], RotationY[Index], RotationZ[Index], RotationW[Index]};
+}
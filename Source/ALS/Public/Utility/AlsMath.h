@@ -45,6 +45,12 @@ public:
 	template <typename ValueType>
 	static ValueType DamperExact(const ValueType& Current, const ValueType& Target, float DeltaTime, float HalfLife);
 
+	// Same as DamperExactAlpha(), but calculates alphas for three half-lives at once using vector instructions.
+	static FVector3f DamperExactAlphaPerAxis(float DeltaTime, const FVector3f& HalfLife);
+
+	// Same as DamperExact(), but with a separate half-life for each axis.
+	static FVector DamperExactPerAxis(const FVector& Current, const FVector& Target, float DeltaTime, const FVector3f& HalfLife);
+
 	template <typename ValueType, typename StateType>
 	static ValueType SpringDamper(StateType& SpringState, const ValueType& Current, const ValueType& Target,
 	                              float DeltaTime, float Frequency, float DampingRatio, float TargetVelocityAmount = 1.0f);
@@ -97,6 +103,36 @@ ValueType UAlsMath::DamperExact(const ValueType& Current, const ValueType& Targe
 	return FMath::Lerp(Current, Target, DamperExactAlpha(DeltaTime, HalfLife));
 }
 
+inline FVector3f UAlsMath::DamperExactAlphaPerAxis(const float DeltaTime, const FVector3f& HalfLife)
+{
+	// Vectorized version of 1.0f - FMath::InvExpApprox(Ln2 / (HalfLife + UE_SMALL_NUMBER) * DeltaTime) with the same coefficients.
+
+	static constexpr auto A{1.00746054f};
+	static constexpr auto B{0.45053901f};
+	static constexpr auto C{0.25724632f};
+
+	const auto X{
+		VectorDivide(VectorSetFloat1(Ln2 * DeltaTime),
+		             VectorAdd(VectorLoadFloat3(&HalfLife.X), VectorSetFloat1(UE_SMALL_NUMBER)))
+	};
+
+	const auto Denominator{
+		VectorMultiplyAdd(X, VectorMultiplyAdd(X, VectorMultiplyAdd(X, VectorSetFloat1(C), VectorSetFloat1(B)), VectorSetFloat1(A)),
+		                  GlobalVectorConstants::FloatOne)
+	};
+
+	FVector3f Alpha;
+	VectorStoreFloat3(VectorDivide(VectorSubtract(Denominator, GlobalVectorConstants::FloatOne), Denominator), &Alpha.X);
+
+	return Alpha;
+}
+
+inline FVector UAlsMath::DamperExactPerAxis(const FVector& Current, const FVector& Target,
+                                            const float DeltaTime, const FVector3f& HalfLife)
+{
+	return Current + (Target - Current) * FVector{DamperExactAlphaPerAxis(DeltaTime, HalfLife)};
+}
+
 template <typename ValueType, typename StateType>
 ValueType UAlsMath::SpringDamper(StateType& SpringState, const ValueType& Current, const ValueType& Target, const float DeltaTime,
                                  const float Frequency, const float DampingRatio, const float TargetVelocityAmount)
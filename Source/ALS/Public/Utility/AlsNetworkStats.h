@@ -0,0 +1,26 @@
+#pragma once
+
+class AActor;
+class UClass;
+class UFunction;
+
+// Collects the estimated network cost of replicated properties and RPCs of ALS actors. Collection is disabled
+// by default and can be enabled with the Als.NetworkStats.Enable console variable. The collected data can be printed
+// with the Als.NetworkStats.Dump console command, reset with Als.NetworkStats.Reset, and is also available in the
+// AlsNetwork CSV profiler category. Only the payload bits of the sending side are counted, without packet headers.
+namespace AlsNetworkStats
+{
+	ALS_API bool IsEnabled();
+
+	// Records replicated properties declared in the specified class or its subclasses that have changed since
+	// the last call. Should be called from AActor::PreReplication(), which is called once per actor net update.
+	ALS_API void RecordReplicatedProperties(const AActor* Actor, const UClass* OwnerClass);
+
+	// Should be called from AActor::CallRemoteFunction(), before calling the parent implementation.
+	ALS_API void RecordRemoteFunction(const AActor* Actor, const UFunction* Function, void* Parameters, const UClass* OwnerClass);
+
+	// Returns the total number of bits of replicated properties and RPCs recorded since the last reset.
+	ALS_API void GetTotalBits(int64& PropertyBits, int64& RpcBits);
+
+	ALS_API void Reset();
+}
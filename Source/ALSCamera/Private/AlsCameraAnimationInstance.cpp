@@ -35,6 +35,10 @@ void UAlsCameraAnimationInstance::NativeInitializeAnimation()
 
 void UAlsCameraAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCameraAnimationInstance::NativeUpdateAnimation"),
+	                            STAT_UAlsCameraAnimationInstance_NativeUpdateAnimation, STATGROUP_AlsCamera)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	Super::NativeUpdateAnimation(DeltaTime);
 
 	if (!IsValid(Character) || !IsValid(Camera))
@@ -1,10 +1,13 @@
 #include "AlsCameraComponent.h"
 
 #include "AlsCameraSettings.h"
+#include "AlsSceneQuerySubsystem.h"
 #include "DrawDebugHelpers.h"
+#include "TimerManager.h"
 #include "Animation/AnimInstance.h"
-#include "Engine/OverlapResult.h"
+#include "Engine/SkinnedAsset.h"
 #include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
 #include "GameFramework/WorldSettings.h"
 #include "Utility/AlsCameraConstants.h"
 #include "Utility/AlsDebugUtility.h"
@@ -14,11 +17,75 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCameraComponent)
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Camera Ticks: First Person"), STAT_AlsCamera_FirstPersonTicks, STATGROUP_AlsCamera)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Camera Ticks: Third Person"), STAT_AlsCamera_ThirdPersonTicks, STATGROUP_AlsCamera)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Camera Ticks: Blended"), STAT_AlsCamera_BlendedTicks, STATGROUP_AlsCamera)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Sweeps"), STAT_AlsCamera_Sweeps, STATGROUP_AlsCamera)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Reused Sweeps"), STAT_AlsCamera_ReusedSweeps, STATGROUP_AlsCamera)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Overlaps"), STAT_AlsCamera_Overlaps, STATGROUP_AlsCamera)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Body Overlap Tests"), STAT_AlsCamera_BodyOverlapTests, STATGROUP_AlsCamera)
+
+#if WITH_DEV_AUTOMATION_TESTS
+namespace AlsCameraComponent
+{
+	// Adds the time spent in its scope to one of the per camera counters.
+	struct FCyclesScope
+	{
+		uint64& Cycles;
+
+		const uint64 StartCycles{FPlatformTime::Cycles64()};
+
+		explicit FCyclesScope(uint64& NewCycles)
+			: Cycles{NewCycles} {}
+
+		~FCyclesScope()
+		{
+			Cycles += FPlatformTime::Cycles64() - StartCycles;
+		}
+	};
+}
+
+// Increments both the stat and the per camera counter of the same name.
+#define ALS_CAMERA_INC_COUNTER(Name) \
+	INC_DWORD_STAT(STAT_AlsCamera_##Name) \
+	Counters.Name##Count += 1;
+
+#define ALS_CAMERA_SCOPE_CYCLES(Name) const AlsCameraComponent::FCyclesScope CyclesScope_##Name{Counters.Name##Cycles};
+#else
+#define ALS_CAMERA_INC_COUNTER(Name) INC_DWORD_STAT(STAT_AlsCamera_##Name)
+
+#define ALS_CAMERA_SCOPE_CYCLES(Name)
+#endif
+
+void FAlsCameraTickFunction::ExecuteTick(const float DeltaTime, const ELevelTick TickType, const ENamedThreads::Type CurrentThread,
+                                         const FGraphEventRef& CompletionGraphEvent)
+{
+	if (IsValid(Camera) && TickType != LEVELTICK_ViewportsOnly)
+	{
+		Camera->TickCamera(Camera->CameraDeltaTime);
+	}
+}
+
+FString FAlsCameraTickFunction::DiagnosticMessage()
+{
+	return (IsValid(Camera) ? Camera->GetFullName() : FString{TEXTVIEW("<NULL>")}) + TEXT("[TickCamera]");
+}
+
+FName FAlsCameraTickFunction::DiagnosticContext(const bool bDetailed)
+{
+	return IsValid(Camera) ? Camera->GetClass()->GetFName() : NAME_None;
+}
+
 UAlsCameraComponent::UAlsCameraComponent()
 {
 	PrimaryComponentTick.bStartWithTickEnabled = false;
 	PrimaryComponentTick.TickGroup = TG_PostPhysics;
 
+	CameraTick.bCanEverTick = true;
+	CameraTick.bStartWithTickEnabled = false;
+	CameraTick.TickGroup = TG_PostUpdateWork;
+	CameraTick.bRunOnAnyThread = false;
+
 	bTickInEditor = false;
 	bHiddenInGame = true;
 }
@@ -36,9 +103,30 @@ void UAlsCameraComponent::OnRegister()
 {
 	Character = Cast<ACharacter>(GetOwner());
 
+	if (bStripInvisibleMeshState && IsValid(GetWorld()) && GetWorld()->IsGameWorld())
+	{
+		// Nothing depends on the camera mesh bounds, overlaps or physics, so skip updating them after each animation evaluation.
+
+		bComponentUseFixedSkelBounds = true;
+		bUpdateOverlapsOnAnimationFinalize = false;
+		KinematicBonesUpdateType = EKinematicBonesUpdateToPhysics::SkipAllBones;
+	}
+
 	Super::OnRegister();
 }
 
+bool UAlsCameraComponent::ShouldCreateRenderState() const
+{
+	// Keep the render state in editor worlds so that the camera mesh can still be previewed.
+
+	return (!bStripInvisibleMeshState || !IsValid(GetWorld()) || !GetWorld()->IsGameWorld()) && Super::ShouldCreateRenderState();
+}
+
+bool UAlsCameraComponent::ShouldCreatePhysicsState() const
+{
+	return (!bStripInvisibleMeshState || !IsValid(GetWorld()) || !GetWorld()->IsGameWorld()) && Super::ShouldCreatePhysicsState();
+}
+
 void UAlsCameraComponent::RegisterComponentTickFunctions(const bool bRegister)
 {
 	Super::RegisterComponentTickFunctions(bRegister);
@@ -46,12 +134,50 @@ void UAlsCameraComponent::RegisterComponentTickFunctions(const bool bRegister)
 	// Tick after the owner to have access to the most up-to-date character state.
 
 	AddTickPrerequisiteActor(GetOwner());
+
+	if (!bRegister)
+	{
+		if (CameraTick.IsTickFunctionRegistered())
+		{
+			CameraTick.UnRegisterTickFunction();
+		}
+	}
+	else if (bUseSeparateCameraTick && SetupActorComponentTickFunction(&CameraTick))
+	{
+		CameraTick.Camera = this;
+
+		// Don't depend on the camera mesh tick, since its completion is delayed until its parallel animation evaluation completes.
+
+		if (IsValid(GetOwner()))
+		{
+			CameraTick.AddPrerequisite(GetOwner(), GetOwner()->PrimaryActorTick);
+		}
+	}
+}
+
+void UAlsCameraComponent::SetComponentTickEnabled(bool bEnabled)
+{
+	// A dormant camera should not tick, even if it is activated, until it wakes up.
+
+	bEnabled &= !bDormant;
+
+	Super::SetComponentTickEnabled(bEnabled);
+
+	if (CameraTick.IsTickFunctionRegistered())
+	{
+		CameraTick.SetTickFunctionEnable(bEnabled);
+	}
 }
 
 void UAlsCameraComponent::Activate(const bool bReset)
 {
 	if (bReset || ShouldActivate())
 	{
+		if (!IsRunningParallelEvaluation())
+		{
+			RefreshCurveValues();
+		}
+
 		TickCamera(0.0f, false);
 	}
 
@@ -72,6 +198,23 @@ void UAlsCameraComponent::BeginPlay()
 	ALS_ENSURE(IsValid(Character));
 
 	Super::BeginPlay();
+
+	if (bEnableDormancy)
+	{
+		GetWorld()->GetTimerManager().SetTimer(DormancyCheckTimer, this, &ThisClass::RefreshDormancy, DormancyCheckInterval, true);
+
+		RefreshDormancy();
+	}
+}
+
+void UAlsCameraComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (IsValid(GetWorld()))
+	{
+		GetWorld()->GetTimerManager().ClearTimer(DormancyCheckTimer);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UAlsCameraComponent::TickComponent(float DeltaTime, const ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -87,6 +230,7 @@ void UAlsCameraComponent::TickComponent(float DeltaTime, const ELevelTick TickTy
 	}
 
 	PreviousGlobalTimeDilation = GetWorld()->GetWorldSettings()->GetEffectiveTimeDilation();
+	CameraDeltaTime = DeltaTime;
 
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
@@ -94,7 +238,12 @@ void UAlsCameraComponent::TickComponent(float DeltaTime, const ELevelTick TickTy
 
 	if (!IsRunningParallelEvaluation())
 	{
-		TickCamera(DeltaTime);
+		RefreshCurveValues();
+
+		if (!bUseSeparateCameraTick)
+		{
+			TickCamera(DeltaTime);
+		}
 	}
 }
 
@@ -102,12 +251,17 @@ void UAlsCameraComponent::CompleteParallelAnimationEvaluation(const bool bDoPost
 {
 	Super::CompleteParallelAnimationEvaluation(bDoPostAnimationEvaluation);
 
-	TickCamera(GetAnimInstance()->GetDeltaSeconds());
+	RefreshCurveValues();
+
+	if (!bUseSeparateCameraTick)
+	{
+		TickCamera(GetAnimInstance()->GetDeltaSeconds());
+	}
 }
 
 FVector UAlsCameraComponent::GetFirstPersonCameraLocation() const
 {
-	return Character->GetMesh()->GetSocketLocation(Settings->FirstPerson.CameraSocketName);
+	return GetCharacterMeshSocketLocation(Settings->FirstPerson.CameraSocketName, FirstPersonCameraSocketCache);
 }
 
 FVector UAlsCameraComponent::GetThirdPersonPivotLocation() const
@@ -125,17 +279,58 @@ FVector UAlsCameraComponent::GetThirdPersonPivotLocation() const
 	}
 	else
 	{
-		FirstPivotLocation = Mesh->GetSocketLocation(Settings->ThirdPerson.FirstPivotSocketName);
+		FirstPivotLocation = GetCharacterMeshSocketLocation(Settings->ThirdPerson.FirstPivotSocketName, FirstPivotSocketCache);
 	}
 
-	return (FirstPivotLocation + Mesh->GetSocketLocation(Settings->ThirdPerson.SecondPivotSocketName)) * 0.5f;
+	const auto SecondPivotLocation{GetCharacterMeshSocketLocation(Settings->ThirdPerson.SecondPivotSocketName, SecondPivotSocketCache)};
+
+	return (FirstPivotLocation + SecondPivotLocation) * 0.5f;
 }
 
 FVector UAlsCameraComponent::GetThirdPersonTraceStartLocation() const
 {
-	return Character->GetMesh()->GetSocketLocation(bRightShoulder
-		                                               ? Settings->ThirdPerson.TraceShoulderRightSocketName
-		                                               : Settings->ThirdPerson.TraceShoulderLeftSocketName);
+	return bRightShoulder
+		       ? GetCharacterMeshSocketLocation(Settings->ThirdPerson.TraceShoulderRightSocketName, TraceShoulderRightSocketCache)
+		       : GetCharacterMeshSocketLocation(Settings->ThirdPerson.TraceShoulderLeftSocketName, TraceShoulderLeftSocketCache);
+}
+
+FVector UAlsCameraComponent::GetCharacterMeshSocketLocation(const FName& SocketName, FAlsCameraSocketCache& SocketCache) const
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCameraComponent::GetCharacterMeshSocketLocation"),
+	                            STAT_UAlsCameraComponent_GetCharacterMeshSocketLocation, STATGROUP_AlsCamera)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	const auto* Mesh{Character->GetMesh()};
+	const auto* SkinnedAsset{Mesh->GetSkinnedAsset()};
+
+	if (SocketCache.SocketName != SocketName || SocketCache.SkinnedAsset != SkinnedAsset)
+	{
+		// Resolve the socket or bone once, and then only re-resolve it if the socket name or the mesh changes.
+
+		SocketCache.SkinnedAsset = SkinnedAsset;
+		SocketCache.SocketName = SocketName;
+		SocketCache.BoneIndex = INDEX_NONE;
+		SocketCache.SocketTransform = FTransform::Identity;
+
+		if (IsValid(SkinnedAsset))
+		{
+			int32 SocketIndex;
+			if (SkinnedAsset->FindSocketInfo(SocketName, SocketCache.SocketTransform, SocketCache.BoneIndex, SocketIndex) == nullptr)
+			{
+				SocketCache.SocketTransform = FTransform::Identity;
+				SocketCache.BoneIndex = Mesh->GetBoneIndex(SocketName);
+			}
+		}
+	}
+
+	if (SocketCache.BoneIndex < 0 || SocketCache.BoneIndex >= Mesh->GetNumComponentSpaceTransforms())
+	{
+		// Fall back to the regular lookup for names that are not sockets or bones of the skinned asset itself.
+
+		return Mesh->GetSocketLocation(SocketName);
+	}
+
+	return (SocketCache.SocketTransform * Mesh->GetBoneTransform(SocketCache.BoneIndex)).GetLocation();
 }
 
 void UAlsCameraComponent::GetViewInfo(FMinimalViewInfo& ViewInfo) const
@@ -152,21 +347,138 @@ void UAlsCameraComponent::GetViewInfo(FMinimalViewInfo& ViewInfo) const
 	}
 }
 
-void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
+void UAlsCameraComponent::WakeUp()
 {
-	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCameraComponent::TickCamera"), STAT_UAlsCameraComponent_TickCamera, STATGROUP_Als)
+	if (bDormant)
+	{
+		SetDormant(false);
+	}
+}
+
+bool UAlsCameraComponent::IsOwnerViewTargetOfLocalPlayer() const
+{
+	for (auto Iterator{GetWorld()->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+	{
+		const auto* Player{Iterator->Get()};
+		if (IsValid(Player) && Player->IsLocalController() && Player->GetViewTarget() == GetOwner())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UAlsCameraComponent::RefreshDormancy()
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCameraComponent::RefreshDormancy"),
+	                            STAT_UAlsCameraComponent_RefreshDormancy, STATGROUP_AlsCamera)
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
 
-	if (!IsValid(GetAnimInstance()) || !IsValid(Settings) || !IsValid(Character))
+	SetDormant(!IsOwnerViewTargetOfLocalPlayer());
+}
+
+void UAlsCameraComponent::SetDormant(const bool bNewDormant)
+{
+	if (bDormant == bNewDormant)
+	{
+		return;
+	}
+
+	bDormant = bNewDormant;
+
+	if (bDormant)
+	{
+		SetComponentTickEnabled(false);
+
+		if (bReleaseAnimationInstanceWhenDormant)
+		{
+			ClearAnimScriptInstance();
+		}
+
+		return;
+	}
+
+	if (!IsValid(GetAnimInstance()))
+	{
+		InitAnim(true);
+
+		// The new animation instance has no curve values until it is evaluated, so evaluate it once right away, otherwise the
+		// camera will use the default curve values until the next animation tick. Without a tick function, the bone transforms
+		// are always refreshed on the game thread, so the curve values can be read immediately after that.
+
+		if (IsActive() && IsValid(GetAnimInstance()))
+		{
+			TickAnimation(0.0f, false);
+			RefreshBoneTransforms();
+		}
+	}
+
+	// Only resume ticking if the camera has not been deactivated in the meantime.
+
+	if (IsActive())
+	{
+		SetComponentTickEnabled(true);
+
+		if (!IsRunningParallelEvaluation())
+		{
+			RefreshCurveValues();
+		}
+
+		TickCamera(0.0f, false);
+	}
+}
+
+void UAlsCameraComponent::RefreshCurveValues()
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCameraComponent::RefreshCurveValues"),
+	                            STAT_UAlsCameraComponent_RefreshCurveValues, STATGROUP_AlsCamera)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+	const auto* AnimationInstance{GetAnimInstance()};
+	if (!IsValid(AnimationInstance))
 	{
 		return;
 	}
 
 	ALS_ENSURE_MESSAGE(!IsRunningParallelEvaluation(), // NOLINT(clang-diagnostic-unused-value)
-	                   TEXT("UAlsCameraComponent::TickCamera() should not be called during parallel animation")
+	                   TEXT("UAlsCameraComponent::RefreshCurveValues() should not be called during parallel animation")
 	                   TEXT(" evaluation, because accessing animation curves causes the game thread to wait")
 	                   TEXT(" for the parallel task to complete, resulting in performance degradation"));
 
+	CurveValues.PivotOffset.X = AnimationInstance->GetCurveValue(UAlsCameraConstants::PivotOffsetXCurveName());
+	CurveValues.PivotOffset.Y = AnimationInstance->GetCurveValue(UAlsCameraConstants::PivotOffsetYCurveName());
+	CurveValues.PivotOffset.Z = AnimationInstance->GetCurveValue(UAlsCameraConstants::PivotOffsetZCurveName());
+
+	CurveValues.CameraOffset.X = AnimationInstance->GetCurveValue(UAlsCameraConstants::CameraOffsetXCurveName());
+	CurveValues.CameraOffset.Y = AnimationInstance->GetCurveValue(UAlsCameraConstants::CameraOffsetYCurveName());
+	CurveValues.CameraOffset.Z = AnimationInstance->GetCurveValue(UAlsCameraConstants::CameraOffsetZCurveName());
+
+	CurveValues.LocationLag.X = AnimationInstance->GetCurveValue(UAlsCameraConstants::LocationLagXCurveName());
+	CurveValues.LocationLag.Y = AnimationInstance->GetCurveValue(UAlsCameraConstants::LocationLagYCurveName());
+	CurveValues.LocationLag.Z = AnimationInstance->GetCurveValue(UAlsCameraConstants::LocationLagZCurveName());
+
+	CurveValues.RotationLag = AnimationInstance->GetCurveValue(UAlsCameraConstants::RotationLagCurveName());
+	CurveValues.FovOffset = AnimationInstance->GetCurveValue(UAlsCameraConstants::FovOffsetCurveName());
+
+	CurveValues.FirstPersonOverride = UAlsMath::Clamp01(
+		AnimationInstance->GetCurveValue(UAlsCameraConstants::FirstPersonOverrideCurveName()));
+
+	CurveValues.TraceOverride = UAlsMath::Clamp01(AnimationInstance->GetCurveValue(UAlsCameraConstants::TraceOverrideCurveName()));
+}
+
+void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCameraComponent::TickCamera"),
+	                            STAT_UAlsCameraComponent_TickCamera, STATGROUP_AlsCamera)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+	ALS_CAMERA_SCOPE_CYCLES(TickCamera)
+
+	if (!IsValid(GetAnimInstance()) || !IsValid(Settings) || !IsValid(Character))
+	{
+		return;
+	}
+
 #if ENABLE_DRAW_DEBUG
 	const auto bDisplayDebugCameraShapes{
 		UAlsDebugUtility::ShouldDisplayDebugForActor(GetOwner(), UAlsCameraConstants::CameraShapesDebugDisplayName())
@@ -214,13 +526,14 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 
 	PivotTargetLocation = GetThirdPersonPivotLocation();
 
-	const auto FirstPersonOverride{
-		UAlsMath::Clamp01(GetAnimInstance()->GetCurveValue(UAlsCameraConstants::FirstPersonOverrideCurveName()))
-	};
+	const auto FirstPersonOverride{CurveValues.FirstPersonOverride};
 
 	if (FAnimWeight::IsFullWeight(FirstPersonOverride))
 	{
-		// Skip other calculations if the character is fully in first-person mode.
+		ALS_CAMERA_INC_COUNTER(FirstPersonTicks)
+
+		// Skip the third-person pivot lag, offsets and trace if the character is fully in first-person mode, but keep their state
+		// consistent with the current character state, so that the camera doesn't pop when it starts blending out of first person.
 
 		PivotLagLocation = PivotTargetLocation;
 		PivotLocation = PivotTargetLocation;
@@ -228,6 +541,20 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 		CameraLocation = GetFirstPersonCameraLocation();
 		CameraRotation = CameraTargetRotation;
 
+		if (bMovementBaseHasRelativeRotation)
+		{
+			const auto MovementBaseRotationInverse{MovementBaseRotation.Inverse()};
+
+			PivotMovementBaseRelativeLagLocation = MovementBaseRotationInverse.RotateVector(PivotLagLocation - MovementBaseLocation);
+			CameraMovementBaseRelativeRotation = MovementBaseRotationInverse * CameraRotation.Quaternion();
+		}
+
+		// A fully unobstructed trace distance ratio makes the trace distance smoothing snap to
+		// the first trace result instead of interpolating from a ratio that is no longer relevant.
+
+		TraceDistanceRatio = 1.0f;
+		bCachedTraceValid = false;
+
 		CameraFieldOfView = bOverrideFieldOfView ? FieldOfViewOverride : Settings->FirstPerson.FieldOfView;
 		return;
 	}
@@ -314,11 +641,15 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 
 	if (!FAnimWeight::IsRelevant(FirstPersonOverride))
 	{
+		ALS_CAMERA_INC_COUNTER(ThirdPersonTicks)
+
 		CameraLocation = CameraFinalLocation;
 		CameraFieldOfView = Settings->ThirdPerson.FieldOfView;
 	}
 	else
 	{
+		ALS_CAMERA_INC_COUNTER(BlendedTicks)
+
 		CameraLocation = FMath::Lerp(CameraFinalLocation, GetFirstPersonCameraLocation(), FirstPersonOverride);
 		CameraFieldOfView = FMath::Lerp(Settings->ThirdPerson.FieldOfView, Settings->FirstPerson.FieldOfView, FirstPersonOverride);
 	}
@@ -339,13 +670,15 @@ FRotator UAlsCameraComponent::CalculateCameraRotation(const FRotator& CameraTarg
 		return CameraTargetRotation;
 	}
 
-	const auto RotationLag{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::RotationLagCurveName())};
-
-	return UAlsRotation::DamperExactRotation(CameraRotation, CameraTargetRotation, DeltaTime, RotationLag);
+	return UAlsRotation::DamperExactRotation(CameraRotation, CameraTargetRotation, DeltaTime, CurveValues.RotationLag);
 }
 
 FVector UAlsCameraComponent::CalculatePivotLagLocation(const FQuat& CameraYawRotation, const float DeltaTime, const bool bAllowLag) const
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCameraComponent::CalculatePivotLagLocation"),
+	                            STAT_UAlsCameraComponent_CalculatePivotLagLocation, STATGROUP_AlsCamera)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
 	if (!bAllowLag)
 	{
 		return PivotTargetLocation;
@@ -354,45 +687,34 @@ FVector UAlsCameraComponent::CalculatePivotLagLocation(const FQuat& CameraYawRot
 	const auto RelativePivotInitialLagLocation{CameraYawRotation.UnrotateVector(PivotLagLocation)};
 	const auto RelativePivotTargetLocation{CameraYawRotation.UnrotateVector(PivotTargetLocation)};
 
-	const auto LocationLagX{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::LocationLagXCurveName())};
-	const auto LocationLagY{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::LocationLagYCurveName())};
-	const auto LocationLagZ{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::LocationLagZCurveName())};
-
-	return CameraYawRotation.RotateVector({
-		UAlsMath::DamperExact(RelativePivotInitialLagLocation.X, RelativePivotTargetLocation.X, DeltaTime, LocationLagX),
-		UAlsMath::DamperExact(RelativePivotInitialLagLocation.Y, RelativePivotTargetLocation.Y, DeltaTime, LocationLagY),
-		UAlsMath::DamperExact(RelativePivotInitialLagLocation.Z, RelativePivotTargetLocation.Z, DeltaTime, LocationLagZ)
-	});
+	return CameraYawRotation.RotateVector(UAlsMath::DamperExactPerAxis(RelativePivotInitialLagLocation, RelativePivotTargetLocation,
+	                                                                   DeltaTime, CurveValues.LocationLag));
 }
 
 FVector UAlsCameraComponent::CalculatePivotOffset() const
 {
 	return Character->GetMesh()->GetComponentQuat().RotateVector(
-		FVector{
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::PivotOffsetXCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::PivotOffsetYCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::PivotOffsetZCurveName())
-		} * Character->GetMesh()->GetComponentScale().Z);
+		FVector{CurveValues.PivotOffset} * Character->GetMesh()->GetComponentScale().Z);
 }
 
 FVector UAlsCameraComponent::CalculateCameraOffset() const
 {
-	return CameraRotation.RotateVector(
-		FVector{
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::CameraOffsetXCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::CameraOffsetYCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::CameraOffsetZCurveName())
-		} * Character->GetMesh()->GetComponentScale().Z);
+	return CameraRotation.RotateVector(FVector{CurveValues.CameraOffset} * Character->GetMesh()->GetComponentScale().Z);
 }
 
 float UAlsCameraComponent::CalculateFovOffset() const
 {
-	return GetAnimInstance()->GetCurveValue(UAlsCameraConstants::FovOffsetCurveName());
+	return CurveValues.FovOffset;
 }
 
 FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLocation, const FVector& PivotOffset,
-                                                  const float DeltaTime, const bool bAllowLag, float& NewTraceDistanceRatio) const
+                                                  const float DeltaTime, const bool bAllowLag, float& NewTraceDistanceRatio)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCameraComponent::CalculateCameraTrace"),
+	                            STAT_UAlsCameraComponent_CalculateCameraTrace, STATGROUP_AlsCamera)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+	ALS_CAMERA_SCOPE_CYCLES(CalculateCameraTrace)
+
 #if ENABLE_DRAW_DEBUG
 	const auto bDisplayDebugCameraTraces{
 		UAlsDebugUtility::ShouldDisplayDebugForActor(GetOwner(), UAlsCameraConstants::CameraTracesDebugDisplayName())
@@ -409,45 +731,76 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
 		FMath::Lerp(
 			GetThirdPersonTraceStartLocation(),
 			PivotTargetLocation + PivotOffset + FVector{Settings->ThirdPerson.TraceOverrideOffset},
-			UAlsMath::Clamp01(GetAnimInstance()->GetCurveValue(UAlsCameraConstants::TraceOverrideCurveName())))
+			CurveValues.TraceOverride)
 	};
 
 	const auto TraceEnd{CameraTargetLocation};
 	const auto CollisionShape{FCollisionShape::MakeSphere(Settings->ThirdPerson.TraceRadius * MeshScale)};
 
 	auto TraceResult{TraceEnd};
+	auto bTraceBlocked{false};
 
-	FHitResult Hit;
-	if (GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
-	                                     CollisionShape, {MainTraceTag, false, GetOwner()}))
+	if (!TryReuseCachedCameraTrace(TraceStart, TraceEnd, bAllowLag, TraceResult, bTraceBlocked) &&
+	    !TryDeferCameraTrace(TraceStart, TraceEnd, bAllowLag, TraceResult, bTraceBlocked))
 	{
-		if (!Hit.bStartPenetrating)
-		{
-			TraceResult = Hit.Location;
-		}
-		else if (TryAdjustLocationBlockedByGeometry(TraceStart, bDisplayDebugCameraTraces))
+		// Only the result of a single unobstructed sweep can be reused later, so the
+		// cache is invalidated here and then validated again if the sweep is suitable.
+
+		bCachedTraceValid = false;
+
+		ALS_CAMERA_INC_COUNTER(Sweeps)
+
+		FHitResult Hit;
+		if (GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
+		                                     CollisionShape, {MainTraceTag, false, GetOwner()}))
 		{
-			static const FName AdjustedTraceTag{FString::Printf(TEXT("%hs (Adjusted Trace)"), __FUNCTION__)};
+			bCachedTraceBlocked = true;
+			CachedTraceTime = Hit.Time;
 
-			GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
-			                                 CollisionShape, {AdjustedTraceTag, false, GetOwner()});
-			if (Hit.IsValidBlockingHit())
+			if (!Hit.bStartPenetrating)
 			{
 				TraceResult = Hit.Location;
+
+				bCachedTraceValid = Hit.Component.IsValid() && Hit.Component->Mobility == EComponentMobility::Static;
+			}
+			else if (TryAdjustLocationBlockedByGeometry(TraceStart, bDisplayDebugCameraTraces))
+			{
+				static const FName AdjustedTraceTag{FString::Printf(TEXT("%hs (Adjusted Trace)"), __FUNCTION__)};
+
+				ALS_CAMERA_INC_COUNTER(Sweeps)
+
+				GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
+				                                 CollisionShape, {AdjustedTraceTag, false, GetOwner()});
+				if (Hit.IsValidBlockingHit())
+				{
+					TraceResult = Hit.Location;
+				}
+			}
+			else
+			{
+				// Note that TraceStart may be changed even if TryAdjustLocationBlockedByGeometry() returned false.
+				TraceResult = TraceStart;
 			}
+
+			bTraceBlocked = Hit.IsValidBlockingHit();
 		}
 		else
 		{
-			// Note that TraceStart may be changed even if TryAdjustLocationBlockedByGeometry() returned false.
-			TraceResult = TraceStart;
+			bCachedTraceValid = true;
+			bCachedTraceBlocked = false;
+			CachedTraceTime = 1.0f;
 		}
+
+		CachedTraceStart = TraceStart;
+		CachedTraceEnd = TraceEnd;
+		CachedTraceReusedFramesCount = 0;
 	}
 
 #if ENABLE_DRAW_DEBUG
 	if (bDisplayDebugCameraTraces)
 	{
 		UAlsDebugUtility::DrawSweepSphere(GetWorld(), TraceStart, TraceResult, CollisionShape.GetCapsuleRadius(),
-		                                  Hit.IsValidBlockingHit() ? FLinearColor::Red : FLinearColor::Green);
+		                                  bTraceBlocked ? FLinearColor::Red : FLinearColor::Green);
 	}
 #endif
 
@@ -478,14 +831,71 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
 	return TraceStart + TraceVector * TraceDistanceRatio;
 }
 
+bool UAlsCameraComponent::TryReuseCachedCameraTrace(const FVector& TraceStart, const FVector& TraceEnd, const bool bAllowLag,
+                                                    FVector& TraceResult, bool& bTraceBlocked)
+{
+	const auto& TraceCachingSettings{Settings->ThirdPerson.TraceCaching};
+
+	if (!bCachedTraceValid || !bAllowLag || !Settings->ThirdPerson.bEnableTraceCaching ||
+	    CachedTraceReusedFramesCount >= TraceCachingSettings.MaxReusedFramesCount ||
+	    FVector::DistSquared(TraceStart, CachedTraceStart) > FMath::Square(TraceCachingSettings.LocationTolerance) ||
+	    FVector::DistSquared(TraceEnd, CachedTraceEnd) > FMath::Square(TraceCachingSettings.LocationTolerance))
+	{
+		return false;
+	}
+
+	// The trace was either not blocked or blocked by a static component, and the trace has barely moved
+	// since then, so the hit time can be applied to the new trace instead of performing a new sweep.
+
+	CachedTraceReusedFramesCount += 1;
+
+	ALS_CAMERA_INC_COUNTER(ReusedSweeps)
+
+	TraceResult = FMath::Lerp(TraceStart, TraceEnd, CachedTraceTime);
+	bTraceBlocked = bCachedTraceBlocked;
+
+	return true;
+}
+
+bool UAlsCameraComponent::TryDeferCameraTrace(const FVector& TraceStart, const FVector& TraceEnd, const bool bAllowLag,
+                                              FVector& TraceResult, bool& bTraceBlocked)
+{
+	if (!bAllowLag)
+	{
+		UAlsSceneQuerySubsystem::RecordQueriesInWorld(GetWorld(), EAlsSceneQueryCategory::Camera);
+		return false;
+	}
+
+	if (UAlsSceneQuerySubsystem::TryAcquireQueriesInWorld(GetWorld(), GetOwner(), TraceStart,
+	                                                      EAlsSceneQueryCategory::Camera, &DeferredTraceQueriesCount))
+	{
+		return false;
+	}
+
+	// The scene query budget is exhausted, so apply the hit time of the previous sweep to the new trace, even if the
+	// sweep is outdated. The hit time of a sweep that started in penetration is zero, which keeps the camera safe.
+
+	TraceResult = FMath::Lerp(TraceStart, TraceEnd, CachedTraceTime);
+	bTraceBlocked = bCachedTraceBlocked;
+
+	return true;
+}
+
 bool UAlsCameraComponent::TryAdjustLocationBlockedByGeometry(FVector& Location, const bool bDisplayDebugCameraTraces) const
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCameraComponent::TryAdjustLocationBlockedByGeometry"),
+	                            STAT_UAlsCameraComponent_TryAdjustLocationBlockedByGeometry, STATGROUP_AlsCamera)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+	ALS_CAMERA_SCOPE_CYCLES(TryAdjustLocationBlockedByGeometry)
+
 	// Based on ComponentEncroachesBlockingGeometry_WithAdjustment().
 
 	const auto MeshScale{UE_REAL_TO_FLOAT(Character->GetMesh()->GetComponentScale().Z)};
 	const auto CollisionShape{FCollisionShape::MakeSphere((Settings->ThirdPerson.TraceRadius + 1.0f) * MeshScale)};
 
-	static TArray<FOverlapResult> Overlaps;
+	// The same camera should never resolve its collision from multiple threads at the same time.
+
+	auto& Overlaps{OverlapsBuffer};
 	check(Overlaps.IsEmpty())
 
 	ON_SCOPE_EXIT
@@ -495,6 +905,8 @@ bool UAlsCameraComponent::TryAdjustLocationBlockedByGeometry(FVector& Location,
 
 	static const FName OverlapMultiTraceTag{FString::Printf(TEXT("%hs (Overlap Multi)"), __FUNCTION__)};
 
+	ALS_CAMERA_INC_COUNTER(Overlaps)
+
 	if (!GetWorld()->OverlapMultiByChannel(Overlaps, Location, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
 	                                       CollisionShape, {OverlapMultiTraceTag, false, GetOwner()}))
 	{
@@ -516,6 +928,8 @@ bool UAlsCameraComponent::TryAdjustLocationBlockedByGeometry(FVector& Location,
 
 		const auto* OverlapBody{Overlap.Component->GetBodyInstance(NAME_None, true, Overlap.ItemIndex)};
 
+		ALS_CAMERA_INC_COUNTER(BodyOverlapTests)
+
 		if (OverlapBody == nullptr || !OverlapBody->OverlapTest(Location, FQuat::Identity, CollisionShape, &MtdResult))
 		{
 			return false;
@@ -554,6 +968,8 @@ bool UAlsCameraComponent::TryAdjustLocationBlockedByGeometry(FVector& Location,
 
 	static const FName FreeSpaceTraceTag{FString::Printf(TEXT("%hs (Free Space Overlap)"), __FUNCTION__)};
 
+	ALS_CAMERA_INC_COUNTER(Overlaps)
+
 	return !GetWorld()->OverlapBlockingTestByChannel(Location, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
 	                                                 FCollisionShape::MakeSphere(Settings->ThirdPerson.TraceRadius * MeshScale),
 	                                                 {FreeSpaceTraceTag, false, GetOwner()});
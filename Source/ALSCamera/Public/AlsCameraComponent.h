@@ -1,11 +1,110 @@
 #pragma once
 
 #include "Components/SkeletalMeshComponent.h"
+#include "Engine/OverlapResult.h"
 #include "Utility/AlsMath.h"
 #include "AlsCameraComponent.generated.h"
 
+DECLARE_STATS_GROUP(TEXT("Als Camera"), STATGROUP_AlsCamera, STATCAT_Advanced)
+
 class UAlsCameraSettings;
+class UAlsCameraComponent;
 class ACharacter;
+class USkinnedAsset;
+
+USTRUCT(BlueprintType)
+struct ALSCAMERA_API FAlsCameraCurveValues
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	FVector3f PivotOffset{ForceInit};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	FVector3f CameraOffset{ForceInit};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	FVector3f LocationLag{ForceInit};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	float RotationLag{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ForceUnits = "deg"))
+	float FovOffset{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 1))
+	float FirstPersonOverride{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 1))
+	float TraceOverride{0.0f};
+};
+
+// Socket or bone of the character mesh resolved once to avoid looking it up by name every frame.
+struct ALSCAMERA_API FAlsCameraSocketCache
+{
+	TWeakObjectPtr<const USkinnedAsset> SkinnedAsset;
+
+	FName SocketName;
+
+	int32 BoneIndex{INDEX_NONE};
+
+	// Socket transform relative to the bone. Identity if the name refers to a bone.
+	FTransform SocketTransform;
+};
+
+#if WITH_DEV_AUTOMATION_TESTS
+// Number of camera ticks by camera mode, of collision queries, and the time spent in the main camera phases of a single
+// camera. Unlike the Als Camera stats group, these are tracked per camera and don't require stats, so that automation
+// tests can check them.
+struct ALSCAMERA_API FAlsCameraCounters
+{
+	int32 FirstPersonTicksCount{0};
+
+	int32 ThirdPersonTicksCount{0};
+
+	int32 BlendedTicksCount{0};
+
+	int32 SweepsCount{0};
+
+	int32 ReusedSweepsCount{0};
+
+	int32 OverlapsCount{0};
+
+	int32 BodyOverlapTestsCount{0};
+
+	uint64 TickCameraCycles{0};
+
+	uint64 CalculateCameraTraceCycles{0};
+
+	uint64 TryAdjustLocationBlockedByGeometryCycles{0};
+};
+#endif
+
+USTRUCT()
+struct ALSCAMERA_API FAlsCameraTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+public:
+	UAlsCameraComponent* Camera{nullptr};
+
+public:
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread,
+	                         const FGraphEventRef& CompletionGraphEvent) override;
+
+	virtual FString DiagnosticMessage() override;
+
+	virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template <>
+struct TStructOpsTypeTraits<FAlsCameraTickFunction> : public TStructOpsTypeTraitsBase2<FAlsCameraTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
 
 UCLASS(ClassGroup = "ALS", Meta = (BlueprintSpawnableComponent),
 	HideCategories = ("ComponentTick", "Clothing", "Physics", "MasterPoseComponent", "Collision", "AnimationRig",
@@ -15,6 +114,8 @@ class ALSCAMERA_API UAlsCameraComponent : public USkeletalMeshComponent
 {
 	GENERATED_BODY()
 
+	friend FAlsCameraTickFunction;
+
 protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	TObjectPtr<UAlsCameraSettings> Settings;
@@ -29,6 +130,35 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ClampMax = 1))
 	float PostProcessWeight{0.0f};
 
+	// If checked, in game worlds the camera mesh will not create render and physics states, will use fixed bounds, and will not
+	// update overlaps. Only enable this if nothing relies on the camera mesh besides the camera animation curves it produces.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	uint8 bStripInvisibleMeshState : 1 {false};
+
+	// If checked, the camera will be updated in a separate game thread tick function in the post update work tick group that
+	// only depends on its owner, instead of right after the camera mesh animation evaluation completes. This lets the game thread
+	// do other work while the camera mesh animation is evaluated on a worker thread, at the cost of a later camera update.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	uint8 bUseSeparateCameraTick : 1 {false};
+
+	// If checked, the camera will stop ticking and evaluating its animation while its owner is not the view target of any local player
+	// controller, for example, on dedicated servers, for AI characters or for simulated proxies, and will wake up when this changes.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	uint8 bEnableDormancy : 1 {false};
+
+	// How often to check whether the owner has become or stopped being the view target of a local player controller.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings",
+		Meta = (ClampMin = 0.01, EditCondition = "bEnableDormancy", ForceUnits = "s"))
+	float DormancyCheckInterval{0.25f};
+
+	// If checked, the camera animation instance will also be released while the camera is dormant.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (EditCondition = "bEnableDormancy"))
+	uint8 bReleaseAnimationInstanceWhenDormant : 1 {false};
+
+	FAlsCameraTickFunction CameraTick;
+
+	FTimerHandle DormancyCheckTimer;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	TObjectPtr<ACharacter> Character;
 
@@ -38,6 +168,13 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ForceUnits = "x"))
 	float PreviousGlobalTimeDilation{1.0f};
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ForceUnits = "s"))
+	float CameraDeltaTime{0.0f};
+
+	// Camera animation curve values cached after each camera mesh animation evaluation.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsCameraCurveValues CurveValues;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FVector PivotTargetLocation{ForceInit};
 
@@ -74,6 +211,51 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	uint8 bRightShoulder : 1 {true};
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	uint8 bDormant : 1 {false};
+
+	// Indicates that the cached trace result below can be reused. See FAlsTraceCachingSettings for details.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	uint8 bCachedTraceValid : 1 {false};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	uint8 bCachedTraceBlocked : 1 {false};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FVector CachedTraceStart{ForceInit};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FVector CachedTraceEnd{ForceInit};
+
+	// Hit time of the cached trace relative to the trace length.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ClampMin = 0, ClampMax = 1))
+	float CachedTraceTime{1.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ClampMin = 0))
+	int32 CachedTraceReusedFramesCount{0};
+
+	// Number of frames in a row for which the trace was deferred by the scene query subsystem.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ClampMin = 0))
+	int32 DeferredTraceQueriesCount{0};
+
+	mutable FAlsCameraSocketCache FirstPersonCameraSocketCache;
+
+	mutable FAlsCameraSocketCache FirstPivotSocketCache;
+
+	mutable FAlsCameraSocketCache SecondPivotSocketCache;
+
+	mutable FAlsCameraSocketCache TraceShoulderLeftSocketCache;
+
+	mutable FAlsCameraSocketCache TraceShoulderRightSocketCache;
+
+	// Scratch buffer used by TryAdjustLocationBlockedByGeometry(). It is kept per component, not shared, so
+	// that multiple cameras can resolve their collision concurrently without reallocating memory every time.
+	mutable TArray<FOverlapResult> OverlapsBuffer;
+
+#if WITH_DEV_AUTOMATION_TESTS
+	mutable FAlsCameraCounters Counters;
+#endif
+
 public:
 	UAlsCameraComponent();
 
@@ -81,14 +263,22 @@ public:
 
 	virtual void OnRegister() override;
 
+	virtual bool ShouldCreateRenderState() const override;
+
+	virtual bool ShouldCreatePhysicsState() const override;
+
 	virtual void RegisterComponentTickFunctions(bool bRegister) override;
 
+	virtual void SetComponentTickEnabled(bool bEnabled) override;
+
 	virtual void Activate(bool bReset) override;
 
 	virtual void InitAnim(bool bForceReinitialize) override;
 
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	virtual void CompleteParallelAnimationEvaluation(bool bDoPostAnimationEvaluation) override;
@@ -127,6 +317,30 @@ public:
 	void GetViewInfo(FMinimalViewInfo& ViewInfo) const;
 
 private:
+	FVector GetCharacterMeshSocketLocation(const FName& SocketName, FAlsCameraSocketCache& SocketCache) const;
+
+	// Dormancy
+
+public:
+	bool IsDormant() const;
+
+	// Immediately wakes up the camera if it is dormant. Should be called before GetViewInfo() if the owner may have become
+	// a view target since the last dormancy check, so that the view information is up to date without waiting for the check.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Camera")
+	void WakeUp();
+
+private:
+	bool IsOwnerViewTargetOfLocalPlayer() const;
+
+	void RefreshDormancy();
+
+	void SetDormant(bool bNewDormant);
+
+	// Camera
+
+private:
+	void RefreshCurveValues();
+
 	void TickCamera(float DeltaTime, bool bAllowLag = true);
 
 	FRotator CalculateCameraRotation(const FRotator& CameraTargetRotation, float DeltaTime, bool bAllowLag) const;
@@ -140,13 +354,25 @@ private:
 	float CalculateFovOffset() const;
 
 	FVector CalculateCameraTrace(const FVector& CameraTargetLocation, const FVector& PivotOffset,
-	                             float DeltaTime, bool bAllowLag, float& NewTraceDistanceRatio) const;
+	                             float DeltaTime, bool bAllowLag, float& NewTraceDistanceRatio);
+
+	bool TryReuseCachedCameraTrace(const FVector& TraceStart, const FVector& TraceEnd, bool bAllowLag,
+	                               FVector& TraceResult, bool& bTraceBlocked);
+
+	bool TryDeferCameraTrace(const FVector& TraceStart, const FVector& TraceEnd, bool bAllowLag,
+	                         FVector& TraceResult, bool& bTraceBlocked);
 
 	bool TryAdjustLocationBlockedByGeometry(FVector& Location, bool bDisplayDebugCameraTraces) const;
 
 	// Debug
 
 public:
+#if WITH_DEV_AUTOMATION_TESTS
+	const FAlsCameraCounters& GetCounters() const;
+
+	void ResetCounters();
+#endif
+
 	void DisplayDebug(const UCanvas* Canvas, const FDebugDisplayInfo& DisplayInfo, float& VerticalLocation) const;
 
 private:
@@ -190,6 +416,23 @@ inline void UAlsCameraComponent::SetPostProcessWeight(const float NewPostProcess
 	PostProcessWeight = UAlsMath::Clamp01(NewPostProcessWeight);
 }
 
+inline bool UAlsCameraComponent::IsDormant() const
+{
+	return bDormant;
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+inline const FAlsCameraCounters& UAlsCameraComponent::GetCounters() const
+{
+	return Counters;
+}
+
+inline void UAlsCameraComponent::ResetCounters()
+{
+	Counters = {};
+}
+#endif
+
 inline bool UAlsCameraComponent::IsRightShoulder() const
 {
 	return bRightShoulder;
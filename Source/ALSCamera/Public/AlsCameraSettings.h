@@ -27,6 +27,22 @@ struct ALSCAMERA_API FAlsTraceDistanceSmoothingSettings
 	float InterpolationHalfLife{0.2f};
 };
 
+USTRUCT(BlueprintType)
+struct ALSCAMERA_API FAlsTraceCachingSettings
+{
+	GENERATED_BODY()
+
+	// The previous trace result is reused if the trace start and end locations have moved less than this distance since the
+	// last full trace, and the trace was either not blocked at all or was blocked by a component with static mobility.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float LocationTolerance{0.5f};
+
+	// Maximum number of consecutive frames in which the previous trace result can be reused. This limits the time
+	// it takes for the camera to notice movable objects that have appeared between the camera and the character.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 MaxReusedFramesCount{10};
+};
+
 USTRUCT(BlueprintType)
 struct ALSCAMERA_API FAlsThirdPersonCameraSettings
 {
@@ -62,6 +78,13 @@ struct ALSCAMERA_API FAlsThirdPersonCameraSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
 		DisplayName = "Enable Trace Distance Smoothing", Meta = (EditCondition = "bEnableTraceDistanceSmoothing"))
 	FAlsTraceDistanceSmoothingSettings TraceDistanceSmoothing;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (InlineEditConditionToggle))
+	uint8 bEnableTraceCaching : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		DisplayName = "Enable Trace Caching", Meta = (EditCondition = "bEnableTraceCaching"))
+	FAlsTraceCachingSettings TraceCaching;
 };
 
 UCLASS(Blueprintable, BlueprintType)
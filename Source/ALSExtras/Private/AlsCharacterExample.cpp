@@ -52,6 +52,7 @@ void AAlsCharacterExample::CalcCamera(const float DeltaTime, FMinimalViewInfo& V
 {
 	if (Camera->IsActive())
 	{
+		Camera->WakeUp();
 		Camera->GetViewInfo(ViewInfo);
 		return;
 	}
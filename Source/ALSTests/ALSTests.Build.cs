@@ -0,0 +1,17 @@
+using UnrealBuildTool;
+
+public class ALSTests : ModuleRules
+{
+	public ALSTests(ReadOnlyTargetRules target) : base(target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_6;
+
+		// CppCompileWarningSettings.UnsafeTypeCastWarningLevel = WarningLevel.Warning;
+		CppCompileWarningSettings.NonInlinedGenCppWarningLevel = WarningLevel.Warning;
+
+		PrivateDependencyModuleNames.AddRange([
+			"Core", "CoreUObject", "Engine", "GameplayTags", "UnrealEd", "ALS", "ALSCamera"
+		]);
+	}
+}
@@ -0,0 +1,5 @@
+#include "ALSTestsModule.h"
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, ALSTests)
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Shared harness of the micro-benchmarks that compare an optimized function with the baseline one it replaced.
+
+namespace AlsBenchmarkUtility
+{
+	inline double GetChecksum(const double Value)
+	{
+		return Value;
+	}
+
+	inline double GetChecksum(const FVector& Value)
+	{
+		return Value.X + Value.Y + Value.Z;
+	}
+
+	// Returns the average time of a single call in nanoseconds. The results are reduced with an overload of GetChecksum(),
+	// which is looked up in the namespace of the result type as well, and accumulated so that the compiler cannot skip the calls.
+	template <typename InputType, typename FunctionType>
+	double MeasureNanosecondsPerCall(const TArray<InputType>& Inputs, const int32 PassesCount,
+	                                 const FunctionType& Function, double& Checksum)
+	{
+		const auto StartTime{FPlatformTime::Seconds()};
+
+		for (auto Pass{0}; Pass < PassesCount; Pass++)
+		{
+			for (const auto& Input : Inputs)
+			{
+				Checksum += GetChecksum(Function(Input));
+			}
+		}
+
+		return (FPlatformTime::Seconds() - StartTime) * 1.0e9 / (static_cast<double>(PassesCount) * FMath::Max(1, Inputs.Num()));
+	}
+
+	// Measures both functions on the same inputs and reports their timings. The timings are reported, not asserted.
+	template <typename InputType, typename BaselineFunctionType, typename OptimizedFunctionType>
+	void CompareSpeed(FAutomationTestBase& Test, const TArray<InputType>& Inputs, const int32 PassesCount, const TCHAR* CallName,
+	                  const TCHAR* BaselineName, const BaselineFunctionType& BaselineFunction,
+	                  const TCHAR* OptimizedName, const OptimizedFunctionType& OptimizedFunction)
+	{
+		auto Checksum{0.0};
+
+		const auto BaselineTime{MeasureNanosecondsPerCall(Inputs, PassesCount, BaselineFunction, Checksum)};
+		const auto OptimizedTime{MeasureNanosecondsPerCall(Inputs, PassesCount, OptimizedFunction, Checksum)};
+
+		Test.AddInfo(FString::Printf(TEXT("Time per %s: %s %.2f ns, %s %.2f ns, speedup %.2fx (checksum %g)."),
+		                             CallName, BaselineName, BaselineTime, OptimizedName, OptimizedTime,
+		                             BaselineTime / FMath::Max(OptimizedTime, UE_DOUBLE_SMALL_NUMBER), Checksum));
+	}
+}
+
+#endif
@@ -0,0 +1,298 @@
+#include "AlsCameraComponent.h"
+#include "AlsCameraSettings.h"
+#include "AlsCharacter.h"
+#include "Editor.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+#include "Tests/AutomationEditorCommon.h"
+#include "Utility/AlsGameplayTags.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Plays the playground in PIE, surrounds the player character with randomly placed static and movable blocking boxes,
+// and then runs the camera in several modes, with and without trace caching, which only reuses traces blocked by static
+// geometry. For each mode, the camera ticks, collision queries and time spent in the main camera phases counted by
+// UAlsCameraComponent are reported, not asserted.
+
+namespace AlsCameraBenchmark
+{
+	static constexpr auto MapName{TEXT("/ALS/ALSExtras/Levels/L_Als_Playground")};
+	static constexpr auto ClutterMeshName{TEXT("/Engine/BasicShapes/Cube.Cube")};
+
+	static constexpr auto StartTimeout{30.0};
+	static constexpr auto SettleDuration{1.0};
+	static constexpr auto PhaseDuration{5.0};
+
+	static constexpr auto ClutterActorsCount{300};
+	static constexpr auto ClutterMinDistance{150.0};
+	static constexpr auto ClutterMaxDistance{800.0};
+
+	UWorld* GetPieWorld()
+	{
+		return IsValid(GEditor) ? GEditor->PlayWorld.Get() : nullptr;
+	}
+
+	AAlsCharacter* GetPlayerCharacter(UWorld* World)
+	{
+		const auto* Player{IsValid(World) ? World->GetFirstPlayerController() : nullptr};
+		return IsValid(Player) ? Cast<AAlsCharacter>(Player->GetPawn()) : nullptr;
+	}
+
+	UAlsCameraComponent* GetPlayerCamera(UWorld* World)
+	{
+		const auto* Character{GetPlayerCharacter(World)};
+		return IsValid(Character) ? Character->FindComponentByClass<UAlsCameraComponent>() : nullptr;
+	}
+
+	UAlsCameraSettings* GetCameraSettings(UAlsCameraComponent* Camera)
+	{
+		static const auto* SettingsProperty{
+			FindFProperty<FObjectProperty>(UAlsCameraComponent::StaticClass(), TEXT("Settings"))
+		};
+
+		return SettingsProperty != nullptr
+			       ? Cast<UAlsCameraSettings>(SettingsProperty->GetObjectPropertyValue_InContainer(Camera))
+			       : nullptr;
+	}
+
+	double CyclesToMicroseconds(const uint64 Cycles, const double TicksCount)
+	{
+		return FPlatformTime::ToMilliseconds64(Cycles) * 1000.0 / TicksCount;
+	}
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FAlsWaitForPlayerCameraCommand, FAutomationTestBase*, Test);
+
+bool FAlsWaitForPlayerCameraCommand::Update()
+{
+	if (IsValid(AlsCameraBenchmark::GetPlayerCamera(AlsCameraBenchmark::GetPieWorld())))
+	{
+		return true;
+	}
+
+	if (GetCurrentRunTime() > AlsCameraBenchmark::StartTimeout)
+	{
+		Test->AddError(FString::Printf(TEXT("Timed out waiting for an ALS player character with an ALS camera. Make sure")
+		                               TEXT(" the game mode of %s spawns such characters."), AlsCameraBenchmark::MapName));
+		return true;
+	}
+
+	return false;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FAlsSpawnCameraClutterCommand, FAutomationTestBase*, Test);
+
+bool FAlsSpawnCameraClutterCommand::Update()
+{
+	auto* World{AlsCameraBenchmark::GetPieWorld()};
+	const auto* Character{AlsCameraBenchmark::GetPlayerCharacter(World)};
+	auto* ClutterMesh{LoadObject<UStaticMesh>(nullptr, AlsCameraBenchmark::ClutterMeshName)};
+
+	if (!Test->TestNotNull(TEXT("Player character"), Character) || !Test->TestNotNull(TEXT("Clutter mesh"), ClutterMesh))
+	{
+		return true;
+	}
+
+	// Boxes of various sizes at various heights around the character, so that the camera traces hit something in most
+	// directions, and the camera often ends up inside or close to the geometry and has to resolve the penetration. Half of
+	// the boxes are static, so that the camera trace caching has something to reuse.
+
+	FRandomStream Random{0};
+
+	for (auto i{0}; i < AlsCameraBenchmark::ClutterActorsCount; i++)
+	{
+		const auto Direction{FVector{FVector2D{Random.GetUnitVector()}.GetSafeNormal(), 0.0}};
+
+		const FTransform Transform{
+			FRotator{Random.FRandRange(-45.0, 45.0), Random.FRandRange(-180.0, 180.0), Random.FRandRange(-45.0, 45.0)},
+			Character->GetActorLocation() +
+			Direction * Random.FRandRange(AlsCameraBenchmark::ClutterMinDistance, AlsCameraBenchmark::ClutterMaxDistance) +
+			FVector::UpVector * Random.FRandRange(-50.0, 300.0),
+			FVector{Random.FRandRange(0.2, 1.5), Random.FRandRange(0.2, 1.5), Random.FRandRange(0.2, 3.0)}
+		};
+
+		// Spawn deferred, since the mesh of a static component can't be changed once it is registered.
+
+		auto* Actor{
+			World->SpawnActorDeferred<AStaticMeshActor>(AStaticMeshActor::StaticClass(), Transform, nullptr, nullptr,
+			                                            ESpawnActorCollisionHandlingMethod::AlwaysSpawn)
+		};
+
+		if (!IsValid(Actor))
+		{
+			continue;
+		}
+
+		auto* MeshComponent{Actor->GetStaticMeshComponent()};
+		MeshComponent->SetMobility(i % 2 == 0 ? EComponentMobility::Static : EComponentMobility::Movable);
+		MeshComponent->SetStaticMesh(ClutterMesh);
+		MeshComponent->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+
+		Actor->FinishSpawning(Transform);
+	}
+
+	return true;
+}
+
+class FAlsRunCameraPhaseCommand : public IAutomationLatentCommand
+{
+private:
+	FAutomationTestBase* Test{nullptr};
+
+	FString PhaseName;
+
+	FGameplayTag ViewMode;
+
+	bool bRotateView{false};
+
+	bool bTraceCaching{false};
+
+	bool bPreviousTraceCaching{false};
+
+	bool bMeasuring{false};
+
+	int32 FramesCount{0};
+
+	double MeasureStartTime{0.0};
+
+public:
+	FAlsRunCameraPhaseCommand(FAutomationTestBase* NewTest, const FString& NewPhaseName, const FGameplayTag& NewViewMode,
+	                          const bool bNewRotateView, const bool bNewTraceCaching)
+		: Test{NewTest}, PhaseName{NewPhaseName}, ViewMode{NewViewMode},
+		  bRotateView{bNewRotateView}, bTraceCaching{bNewTraceCaching} {}
+
+	virtual bool Update() override;
+};
+
+bool FAlsRunCameraPhaseCommand::Update()
+{
+	auto* World{AlsCameraBenchmark::GetPieWorld()};
+	auto* Character{AlsCameraBenchmark::GetPlayerCharacter(World)};
+	auto* Camera{AlsCameraBenchmark::GetPlayerCamera(World)};
+
+	auto* CameraSettings{AlsCameraBenchmark::GetCameraSettings(Camera)};
+
+	if (!Test->TestNotNull(FString::Printf(TEXT("%s: player camera"), *PhaseName), Camera) ||
+	    !Test->TestNotNull(FString::Printf(TEXT("%s: player camera settings"), *PhaseName), CameraSettings))
+	{
+		return true;
+	}
+
+	const auto Time{GetCurrentRunTime()};
+
+	if (Character->GetViewMode() != ViewMode)
+	{
+		Character->SetViewMode(ViewMode);
+	}
+
+	if (bRotateView)
+	{
+		// Spin the view around the character, so that the camera keeps moving through the clutter.
+
+		World->GetFirstPlayerController()->SetControlRotation({-15.0 + FMath::Sin(Time) * 30.0, Time * 90.0, 0.0});
+	}
+
+	// Let the camera blend into the new view mode before measuring.
+
+	if (Time < AlsCameraBenchmark::SettleDuration)
+	{
+		return false;
+	}
+
+	if (!bMeasuring)
+	{
+		bMeasuring = true;
+		MeasureStartTime = FPlatformTime::Seconds();
+
+		// The camera settings are a shared asset, so the trace caching is restored at the end of the phase.
+
+		bPreviousTraceCaching = CameraSettings->ThirdPerson.bEnableTraceCaching;
+		CameraSettings->ThirdPerson.bEnableTraceCaching = bTraceCaching;
+
+		Camera->ResetCounters();
+		return false;
+	}
+
+	FramesCount += 1;
+
+	if (Time < AlsCameraBenchmark::SettleDuration + AlsCameraBenchmark::PhaseDuration)
+	{
+		return false;
+	}
+
+	CameraSettings->ThirdPerson.bEnableTraceCaching = bPreviousTraceCaching;
+
+	const auto& Counters{Camera->GetCounters()};
+
+	const auto TicksCount{Counters.FirstPersonTicksCount + Counters.ThirdPersonTicksCount + Counters.BlendedTicksCount};
+	const auto TicksCountDivisor{static_cast<double>(FMath::Max(1, TicksCount))};
+
+	const auto FrameTime{(FPlatformTime::Seconds() - MeasureStartTime) * 1000.0 / FMath::Max(1, FramesCount)};
+
+	Test->TestTrue(FString::Printf(TEXT("%s: camera ticked"), *PhaseName), TicksCount > 0);
+
+	Test->AddInfo(FString::Printf(TEXT("%s: %d frames, %.2f ms per frame. Camera ticks: %d first person, %d third person, %d blended.")
+	                              TEXT(" Per tick: %.2f sweeps, %.2f reused sweeps, %.2f overlaps, %.2f body overlap tests."),
+	                              *PhaseName, FramesCount, FrameTime,
+	                              Counters.FirstPersonTicksCount, Counters.ThirdPersonTicksCount, Counters.BlendedTicksCount,
+	                              Counters.SweepsCount / TicksCountDivisor, Counters.ReusedSweepsCount / TicksCountDivisor,
+	                              Counters.OverlapsCount / TicksCountDivisor, Counters.BodyOverlapTestsCount / TicksCountDivisor));
+
+	// The phase timings are inclusive, i.e. the time of TickCamera() includes the time of the other two.
+
+	Test->AddInfo(FString::Printf(TEXT("%s: time per tick: %.2f us in TickCamera(), %.2f us in CalculateCameraTrace(),")
+	                              TEXT(" %.2f us in TryAdjustLocationBlockedByGeometry()."), *PhaseName,
+	                              AlsCameraBenchmark::CyclesToMicroseconds(Counters.TickCameraCycles, TicksCountDivisor),
+	                              AlsCameraBenchmark::CyclesToMicroseconds(Counters.CalculateCameraTraceCycles, TicksCountDivisor),
+	                              AlsCameraBenchmark::CyclesToMicroseconds(Counters.TryAdjustLocationBlockedByGeometryCycles,
+	                                                                       TicksCountDivisor)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsCameraBenchmark, "Als.Benchmark.Camera",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FAlsCameraBenchmark::RunTest(const FString& Parameters)
+{
+	if (!AutomationOpenMap(AlsCameraBenchmark::MapName))
+	{
+		AddError(FString::Printf(TEXT("Failed to load %s."), AlsCameraBenchmark::MapName));
+		return false;
+	}
+
+	ADD_LATENT_AUTOMATION_COMMAND(FStartPIECommand{false})
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsWaitForPlayerCameraCommand{this})
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsSpawnCameraClutterCommand{this})
+
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsRunCameraPhaseCommand{
+		this, TEXT("Third person"), AlsViewModeTags::ThirdPerson, false, false
+	})
+
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsRunCameraPhaseCommand{
+		this, TEXT("Third person, trace caching"), AlsViewModeTags::ThirdPerson, false, true
+	})
+
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsRunCameraPhaseCommand{
+		this, TEXT("Third person, rotating"), AlsViewModeTags::ThirdPerson, true, false
+	})
+
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsRunCameraPhaseCommand{
+		this, TEXT("Third person, rotating, trace caching"), AlsViewModeTags::ThirdPerson, true, true
+	})
+
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsRunCameraPhaseCommand{
+		this, TEXT("First person, rotating"), AlsViewModeTags::FirstPerson, true, false
+	})
+
+	ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand)
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,98 @@
+#include "AlsBenchmarkUtility.h"
+#include "Utility/AlsMath.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Checks that the alphas of UAlsMath::DamperExactAlphaPerAxis() match those of three UAlsMath::DamperExactAlpha() calls,
+// including the zero half-lives the camera pivot lag uses to disable the lag on an axis, and then times
+// UAlsMath::DamperExactPerAxis() against three UAlsMath::DamperExact() calls, one per axis.
+
+namespace AlsDamperBenchmark
+{
+	static constexpr auto SamplesCount{4096};
+	static constexpr auto PassesCount{1000};
+
+	static constexpr auto AlphaTolerance{1.0e-5f};
+
+	struct FSample
+	{
+		FVector Current;
+		FVector Target;
+		FVector3f HalfLife;
+		float DeltaTime{0.0f};
+	};
+
+	void GenerateSamples(TArray<FSample>& Samples)
+	{
+		FRandomStream Random{0};
+
+		Samples.SetNum(SamplesCount);
+
+		for (auto& Sample : Samples)
+		{
+			Sample.Current = Random.VRand() * Random.FRandRange(0.0, 1000.0);
+			Sample.Target = Random.VRand() * Random.FRandRange(0.0, 1000.0);
+
+			// Include zero half lives, which are used to disable the lag on some axes.
+
+			Sample.HalfLife.X = Random.FRand() < 0.1f ? 0.0f : Random.FRandRange(0.01f, 1.0f);
+			Sample.HalfLife.Y = Random.FRand() < 0.1f ? 0.0f : Random.FRandRange(0.01f, 1.0f);
+			Sample.HalfLife.Z = Random.FRand() < 0.1f ? 0.0f : Random.FRandRange(0.01f, 1.0f);
+
+			Sample.DeltaTime = Random.FRandRange(1.0f / 240.0f, 1.0f / 20.0f);
+		}
+	}
+
+	FVector3f CalculateAlphaScalar(const FSample& Sample)
+	{
+		return {
+			UAlsMath::DamperExactAlpha(Sample.DeltaTime, Sample.HalfLife.X),
+			UAlsMath::DamperExactAlpha(Sample.DeltaTime, Sample.HalfLife.Y),
+			UAlsMath::DamperExactAlpha(Sample.DeltaTime, Sample.HalfLife.Z)
+		};
+	}
+
+	FVector DamperScalar(const FSample& Sample)
+	{
+		return {
+			UAlsMath::DamperExact(Sample.Current.X, Sample.Target.X, Sample.DeltaTime, Sample.HalfLife.X),
+			UAlsMath::DamperExact(Sample.Current.Y, Sample.Target.Y, Sample.DeltaTime, Sample.HalfLife.Y),
+			UAlsMath::DamperExact(Sample.Current.Z, Sample.Target.Z, Sample.DeltaTime, Sample.HalfLife.Z)
+		};
+	}
+
+	FVector DamperPerAxis(const FSample& Sample)
+	{
+		return UAlsMath::DamperExactPerAxis(Sample.Current, Sample.Target, Sample.DeltaTime, Sample.HalfLife);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsDamperBenchmark, "Als.Benchmark.Damper",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FAlsDamperBenchmark::RunTest(const FString& Parameters)
+{
+	TArray<AlsDamperBenchmark::FSample> Samples;
+	AlsDamperBenchmark::GenerateSamples(Samples);
+
+	auto MaxAlphaError{0.0f};
+
+	for (const auto& Sample : Samples)
+	{
+		const auto ScalarAlpha{AlsDamperBenchmark::CalculateAlphaScalar(Sample)};
+		const auto PerAxisAlpha{UAlsMath::DamperExactAlphaPerAxis(Sample.DeltaTime, Sample.HalfLife)};
+
+		MaxAlphaError = FMath::Max(MaxAlphaError, (ScalarAlpha - PerAxisAlpha).GetAbsMax());
+	}
+
+	TestTrue(FString::Printf(TEXT("Max alpha error %g is within %g"), MaxAlphaError, AlsDamperBenchmark::AlphaTolerance),
+	         MaxAlphaError <= AlsDamperBenchmark::AlphaTolerance);
+
+	AlsBenchmarkUtility::CompareSpeed(*this, Samples, AlsDamperBenchmark::PassesCount, TEXT("call"),
+	                                  TEXT("scalar"), &AlsDamperBenchmark::DamperScalar,
+	                                  TEXT("per axis"), &AlsDamperBenchmark::DamperPerAxis);
+
+	return true;
+}
+
+#endif
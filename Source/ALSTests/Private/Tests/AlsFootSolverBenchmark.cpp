@@ -0,0 +1,186 @@
+#include "AlsBenchmarkUtility.h"
+#include "Utility/AlsFootSolverBatch.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Compares the structure-of-arrays foot solver batch used by UAlsAnimationInstance::RefreshFeet() with the per-foot
+// scalar math it replaced, first for correctness and then for speed.
+
+namespace AlsFootSolverBenchmark
+{
+	static constexpr auto CharactersCount{4096};
+	static constexpr auto PassesCount{200};
+
+	static constexpr auto LocationTolerance{1.0e-3};
+	static constexpr auto RotationTolerance{1.0e-6};
+
+	struct FCharacterInput
+	{
+		FTransform ComponentTransformInverse;
+
+		FVector TargetLocations[2];
+		FQuat TargetRotations[2];
+
+		FVector LockLocations[2];
+		FQuat LockRotations[2];
+
+		double LockAmounts[FAlsFootSolverBatch::LanesCount]{};
+	};
+
+	struct FFootOutput
+	{
+		FVector3f LockComponentRelativeLocation;
+		FQuat4f LockComponentRelativeRotation;
+
+		FVector FinalLocation;
+		FQuat FinalRotation;
+	};
+
+	struct FCharacterOutput
+	{
+		FFootOutput Feet[2];
+	};
+
+	double GetChecksum(const FCharacterOutput& Output)
+	{
+		return Output.Feet[0].FinalLocation.X + Output.Feet[1].FinalRotation.W;
+	}
+
+	FQuat MakeRandomRotation(FRandomStream& Random)
+	{
+		return FRotator{Random.FRandRange(-89.0, 89.0), Random.FRandRange(-180.0, 180.0), Random.FRandRange(-180.0, 180.0)}.Quaternion();
+	}
+
+	void GenerateInputs(TArray<FCharacterInput>& Inputs)
+	{
+		FRandomStream Random{0};
+
+		Inputs.SetNum(CharactersCount);
+
+		for (auto& Input : Inputs)
+		{
+			const FTransform ComponentTransform{
+				MakeRandomRotation(Random), Random.VRand() * Random.FRandRange(0.0, 100000.0), FVector{Random.FRandRange(0.5, 2.0)}
+			};
+
+			Input.ComponentTransformInverse = ComponentTransform.Inverse();
+
+			for (auto i{0}; i < 2; i++)
+			{
+				const auto FootOffset{Random.VRand() * Random.FRandRange(0.0, 100.0)};
+
+				Input.TargetLocations[i] = ComponentTransform.GetLocation() + FootOffset;
+				Input.TargetRotations[i] = MakeRandomRotation(Random);
+
+				Input.LockLocations[i] = Input.TargetLocations[i] + Random.VRand() * Random.FRandRange(0.0, 50.0);
+				Input.LockRotations[i] = MakeRandomRotation(Random);
+
+				Input.LockAmounts[i] = Random.FRand();
+			}
+		}
+	}
+
+	FCharacterOutput SolveScalar(const FCharacterInput& Input)
+	{
+		FCharacterOutput CharacterOutput;
+
+		for (auto i{0}; i < 2; i++)
+		{
+			auto& Output{CharacterOutput.Feet[i]};
+
+			Output.LockComponentRelativeLocation = FVector3f{Input.ComponentTransformInverse.TransformPosition(Input.LockLocations[i])};
+			Output.LockComponentRelativeRotation = FQuat4f{Input.ComponentTransformInverse.TransformRotation(Input.LockRotations[i])};
+
+			const auto FinalLocation{FMath::Lerp(Input.TargetLocations[i], Input.LockLocations[i], Input.LockAmounts[i])};
+
+			auto FinalRotation{FQuat::FastLerp(Input.TargetRotations[i], Input.LockRotations[i], Input.LockAmounts[i])};
+			FinalRotation.Normalize();
+
+			Output.FinalLocation = Input.ComponentTransformInverse.TransformPosition(FinalLocation);
+			Output.FinalRotation = Input.ComponentTransformInverse.TransformRotation(FinalRotation);
+		}
+
+		return CharacterOutput;
+	}
+
+	FCharacterOutput SolveBatch(const FCharacterInput& Input)
+	{
+		FAlsFootSolverBatch TargetBatch;
+		FAlsFootSolverBatch LockBatch;
+
+		for (auto i{0}; i < 2; i++)
+		{
+			TargetBatch.Set(i, Input.TargetLocations[i], Input.TargetRotations[i]);
+			LockBatch.Set(i, Input.LockLocations[i], Input.LockRotations[i]);
+		}
+
+		TargetBatch.TransformBy(Input.ComponentTransformInverse);
+		LockBatch.TransformBy(Input.ComponentTransformInverse);
+
+		FAlsFootSolverBatch FinalBatch;
+		FAlsFootSolverBatch::Blend(TargetBatch, LockBatch, Input.LockAmounts, FinalBatch);
+
+		FCharacterOutput CharacterOutput;
+
+		for (auto i{0}; i < 2; i++)
+		{
+			auto& Output{CharacterOutput.Feet[i]};
+
+			Output.LockComponentRelativeLocation = FVector3f{LockBatch.GetLocation(i)};
+			Output.LockComponentRelativeRotation = FQuat4f{LockBatch.GetRotation(i)};
+
+			Output.FinalLocation = FinalBatch.GetLocation(i);
+			Output.FinalRotation = FinalBatch.GetRotation(i);
+		}
+
+		return CharacterOutput;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsFootSolverBenchmark, "Als.Benchmark.FootSolver",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FAlsFootSolverBenchmark::RunTest(const FString& Parameters)
+{
+	TArray<AlsFootSolverBenchmark::FCharacterInput> Inputs;
+	AlsFootSolverBenchmark::GenerateInputs(Inputs);
+
+	auto MaxLocationError{0.0};
+	auto MaxRotationError{0.0};
+
+	for (const auto& Input : Inputs)
+	{
+		const auto ScalarOutput{AlsFootSolverBenchmark::SolveScalar(Input)};
+		const auto BatchOutput{AlsFootSolverBenchmark::SolveBatch(Input)};
+
+		for (auto i{0}; i < 2; i++)
+		{
+			const auto& Scalar{ScalarOutput.Feet[i]};
+			const auto& Batch{BatchOutput.Feet[i]};
+
+			MaxLocationError = FMath::Max(MaxLocationError, FVector::Dist(Scalar.FinalLocation, Batch.FinalLocation));
+			MaxLocationError = FMath::Max(MaxLocationError, static_cast<double>(
+				                              FVector3f::Dist(Scalar.LockComponentRelativeLocation, Batch.LockComponentRelativeLocation)));
+
+			// Compare the rotations by the dot product, since q and -q represent the same rotation.
+
+			MaxRotationError = FMath::Max(MaxRotationError, 1.0 - FMath::Abs(Scalar.FinalRotation | Batch.FinalRotation));
+			MaxRotationError = FMath::Max(MaxRotationError, 1.0 - FMath::Abs(static_cast<double>(
+				                              Scalar.LockComponentRelativeRotation | Batch.LockComponentRelativeRotation)));
+		}
+	}
+
+	TestTrue(FString::Printf(TEXT("Max location error %g is within %g"), MaxLocationError, AlsFootSolverBenchmark::LocationTolerance),
+	         MaxLocationError <= AlsFootSolverBenchmark::LocationTolerance);
+
+	TestTrue(FString::Printf(TEXT("Max rotation error %g is within %g"), MaxRotationError, AlsFootSolverBenchmark::RotationTolerance),
+	         MaxRotationError <= AlsFootSolverBenchmark::RotationTolerance);
+
+	AlsBenchmarkUtility::CompareSpeed(*this, Inputs, AlsFootSolverBenchmark::PassesCount, TEXT("character"),
+	                                  TEXT("scalar"), &AlsFootSolverBenchmark::SolveScalar,
+	                                  TEXT("batch"), &AlsFootSolverBenchmark::SolveBatch);
+
+	return true;
+}
+
+#endif
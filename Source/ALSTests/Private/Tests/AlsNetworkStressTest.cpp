@@ -0,0 +1,714 @@
+#include "AlsCharacter.h"
+#include "AlsCharacterMovementComponent.h"
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "Engine/Channel.h"
+#include "Engine/Engine.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+#include "Settings/AlsCharacterSettings.h"
+#include "Settings/LevelEditorPlaySettings.h"
+#include "Tests/AutomationCommon.h"
+#include "Tests/AutomationEditorCommon.h"
+#include "Utility/AlsGameplayTags.h"
+#include "Utility/AlsNetworkStats.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Runs a listen server and several clients in PIE under emulated packet lag and loss, drives every player with scripted
+// movement, stance, gait and rotation mode changes, mantling, rolling and ragdolling, and then checks that all clients agree
+// with the server once the characters have settled. The initial velocity yaw angle is sent inside the network move data
+// during the test, and its arrival on the server is checked too. Corrections, combined moves, server move time, bandwidth
+// and reliable buffer pressure are reported for each variant.
+
+namespace AlsNetworkStressTest
+{
+	static constexpr auto MapName{TEXT("/ALS/ALSExtras/Levels/L_Als_Playground")};
+
+	static constexpr auto PlayersCount{4};
+
+	static constexpr auto StartTimeout{30.0};
+	static constexpr auto ScenarioDuration{20.0};
+	static constexpr auto PhaseDuration{2.5};
+	static constexpr auto SettleDuration{3.0f};
+
+	static constexpr auto MaxLocationError{25.0};
+
+	// The initial velocity yaw angle is compressed to 16 bits in the move data.
+	static constexpr auto MaxInitialVelocityYawAngleError{0.01f};
+
+	// Saved moves are expected to be combined at low packet loss, while at higher packet loss there may be too few of them.
+	static constexpr auto MaxPacketLossWithCombinedMoves{2};
+
+	enum class EAction : uint8
+	{
+		None,
+		Mantling,
+		Rolling,
+		Ragdolling,
+		Count
+	};
+
+	// State shared between the latent commands of a single test variant.
+	struct FScenarioState
+	{
+		double StartTime{0.0};
+
+		int32 FramesCount{0};
+
+		// Sums of the per-second bandwidth of all connections, sampled every frame.
+
+		int64 ServerOutBytesPerSecondSum{0};
+
+		int64 ClientsOutBytesPerSecondSum{0};
+
+		// Reliable buffer pressure, i.e. the maximum number of outgoing reliable bunches
+		// that were not yet acknowledged on a single channel, and the maximum queued bits.
+
+		int32 MaxOutgoingReliableBunchesCount{0};
+
+		int32 MaxQueuedBits{0};
+
+		int32 MantlingAttemptsCount{0};
+
+		int32 MantlingStartsCount{0};
+
+		int32 RollingStartsCount{0};
+
+		int32 RagdollingStartsCount{0};
+
+		bool bPreviousNetworkStatsEnabled{false};
+
+		bool bPreviousSendInitialVelocityYawAngleWithMoveData{false};
+	};
+
+	using FScenarioStateRef = TSharedRef<FScenarioState>;
+
+	void GetPieWorlds(TArray<UWorld*, TInlineAllocator<8>>& Worlds)
+	{
+		Worlds.Reset();
+
+		for (const auto& WorldContext : GEngine->GetWorldContexts())
+		{
+			auto* World{WorldContext.World()};
+			if (WorldContext.WorldType == EWorldType::PIE && IsValid(World))
+			{
+				Worlds.Add(World);
+			}
+		}
+	}
+
+	AAlsCharacter* FindCharacterByPlayerId(UWorld* World, const int32 PlayerId)
+	{
+		for (TActorIterator<AAlsCharacter> Iterator{World}; Iterator; ++Iterator)
+		{
+			const auto* PlayerState{Iterator->GetPlayerState()};
+			if (IsValid(PlayerState) && PlayerState->GetPlayerId() == PlayerId)
+			{
+				return *Iterator;
+			}
+		}
+
+		return nullptr;
+	}
+
+	int32 CountPlayerCharacters(UWorld* World)
+	{
+		auto Count{0};
+
+		for (TActorIterator<AAlsCharacter> Iterator{World}; Iterator; ++Iterator)
+		{
+			if (IsValid(Iterator->GetPlayerState()))
+			{
+				Count += 1;
+			}
+		}
+
+		return Count;
+	}
+
+	AAlsCharacter* GetLocalCharacter(const APlayerController* Player)
+	{
+		auto* Character{IsValid(Player) && Player->IsLocalController() ? Cast<AAlsCharacter>(Player->GetPawn()) : nullptr};
+		return IsValid(Character) && IsValid(Character->GetPlayerState()) ? Character : nullptr;
+	}
+
+	UAlsCharacterMovementComponent* GetMovement(const AAlsCharacter* Character)
+	{
+		return IsValid(Character) ? Cast<UAlsCharacterMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+	}
+
+	void SetNetEmulation(const int32 PacketLag, const int32 PacketLoss)
+	{
+		TArray<UWorld*, TInlineAllocator<8>> Worlds;
+		GetPieWorlds(Worlds);
+
+		const auto Command{FString::Printf(TEXT("Net PktLag=%d PktLoss=%d"), PacketLag, PacketLoss)};
+
+		for (auto* World : Worlds)
+		{
+			if (IsValid(World->GetNetDriver()))
+			{
+				GEngine->Exec(World, *Command);
+			}
+		}
+	}
+
+	void SetSendInitialVelocityYawAngleWithMoveData(const bool bSendWithMoveData, bool* bPreviousSendWithMoveData = nullptr)
+	{
+		TArray<UWorld*, TInlineAllocator<8>> Worlds;
+		GetPieWorlds(Worlds);
+
+		for (auto* World : Worlds)
+		{
+			for (TActorIterator<AAlsCharacter> Iterator{World}; Iterator; ++Iterator)
+			{
+				// The character settings are a shared asset, so they must be restored at the end of the test.
+
+				auto* Settings{const_cast<UAlsCharacterSettings*>(Iterator->GetSettings())};
+				if (!IsValid(Settings))
+				{
+					continue;
+				}
+
+				if (bPreviousSendWithMoveData != nullptr)
+				{
+					*bPreviousSendWithMoveData = Settings->bSendInitialVelocityYawAngleWithMoveData;
+					bPreviousSendWithMoveData = nullptr;
+				}
+
+				Settings->bSendInitialVelocityYawAngleWithMoveData = bSendWithMoveData;
+			}
+		}
+	}
+
+	void SampleConnection(const UNetConnection* Connection, FScenarioState& State, int64& OutBytesPerSecondSum)
+	{
+		if (!IsValid(Connection))
+		{
+			return;
+		}
+
+		OutBytesPerSecondSum += Connection->OutBytesPerSecond;
+
+		State.MaxQueuedBits = FMath::Max(State.MaxQueuedBits, Connection->QueuedBits);
+
+		for (const auto* Channel : Connection->OpenChannels)
+		{
+			if (IsValid(Channel))
+			{
+				State.MaxOutgoingReliableBunchesCount = FMath::Max(State.MaxOutgoingReliableBunchesCount, Channel->NumOutRec);
+			}
+		}
+	}
+
+	void SampleConnections(FScenarioState& State)
+	{
+		TArray<UWorld*, TInlineAllocator<8>> Worlds;
+		GetPieWorlds(Worlds);
+
+		for (auto* World : Worlds)
+		{
+			const auto* NetDriver{World->GetNetDriver()};
+			if (!IsValid(NetDriver))
+			{
+				continue;
+			}
+
+			if (NetDriver->IsServer())
+			{
+				for (const auto* Connection : NetDriver->ClientConnections)
+				{
+					SampleConnection(Connection, State, State.ServerOutBytesPerSecondSum);
+				}
+			}
+			else
+			{
+				SampleConnection(NetDriver->ServerConnection, State, State.ClientsOutBytesPerSecondSum);
+			}
+		}
+
+		State.FramesCount += 1;
+	}
+
+	void StartAction(AAlsCharacter* Character, const EAction Action, FScenarioState& State)
+	{
+		switch (Action)
+		{
+			case EAction::Mantling:
+				State.MantlingAttemptsCount += 1;
+
+				if (Character->StartMantlingGrounded())
+				{
+					State.MantlingStartsCount += 1;
+				}
+				break;
+
+			case EAction::Rolling:
+				State.RollingStartsCount += 1;
+				Character->StartRolling();
+				break;
+
+			case EAction::Ragdolling:
+				State.RagdollingStartsCount += 1;
+				Character->StartRagdolling();
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	void StopRagdolling(AAlsCharacter* Character)
+	{
+		if (Character->GetLocomotionAction() == AlsLocomotionActionTags::Ragdolling)
+		{
+			Character->StopRagdolling();
+		}
+	}
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND(FAlsStartNetworkPlaySessionCommand);
+
+bool FAlsStartNetworkPlaySessionCommand::Update()
+{
+	auto* PlaySettings{NewObject<ULevelEditorPlaySettings>()};
+	PlaySettings->SetPlayNetMode(PIE_ListenServer);
+	PlaySettings->SetPlayNumberOfClients(AlsNetworkStressTest::PlayersCount);
+	PlaySettings->SetRunUnderOneProcess(true);
+	PlaySettings->bLaunchSeparateServer = false;
+
+	FRequestPlaySessionParams Params;
+	Params.WorldType = EPlaySessionWorldType::PlayInEditor;
+	Params.SessionDestination = EPlaySessionDestinationType::InProcess;
+	Params.EditorPlaySettings = PlaySettings;
+
+	GEditor->RequestPlaySession(Params);
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FAlsWaitForNetworkPlayersCommand, FAutomationTestBase*, Test);
+
+bool FAlsWaitForNetworkPlayersCommand::Update()
+{
+	TArray<UWorld*, TInlineAllocator<8>> Worlds;
+	AlsNetworkStressTest::GetPieWorlds(Worlds);
+
+	auto bReady{Worlds.Num() == AlsNetworkStressTest::PlayersCount};
+
+	for (auto* World : Worlds)
+	{
+		if (!bReady)
+		{
+			break;
+		}
+
+		bReady = AlsNetworkStressTest::CountPlayerCharacters(World) == AlsNetworkStressTest::PlayersCount;
+	}
+
+	if (bReady)
+	{
+		return true;
+	}
+
+	if (GetCurrentRunTime() > AlsNetworkStressTest::StartTimeout)
+	{
+		Test->AddError(FString::Printf(TEXT("Timed out waiting for %d ALS player characters in %d PIE worlds. Make sure the game mode")
+		                               TEXT(" of %s spawns ALS characters."), AlsNetworkStressTest::PlayersCount,
+		                               AlsNetworkStressTest::PlayersCount, AlsNetworkStressTest::MapName));
+		return true;
+	}
+
+	return false;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FAlsSetNetEmulationCommand, int32, PacketLag, int32, PacketLoss);
+
+bool FAlsSetNetEmulationCommand::Update()
+{
+	AlsNetworkStressTest::SetNetEmulation(PacketLag, PacketLoss);
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FAlsBeginNetworkMeasurementCommand, AlsNetworkStressTest::FScenarioStateRef, State);
+
+bool FAlsBeginNetworkMeasurementCommand::Update()
+{
+	auto* NetworkStatsVariable{IConsoleManager::Get().FindConsoleVariable(TEXT("Als.NetworkStats.Enable"))};
+	if (NetworkStatsVariable != nullptr)
+	{
+		State->bPreviousNetworkStatsEnabled = NetworkStatsVariable->GetBool();
+		NetworkStatsVariable->Set(true, ECVF_SetByCode);
+	}
+
+	AlsNetworkStats::Reset();
+
+	AlsNetworkStressTest::SetSendInitialVelocityYawAngleWithMoveData(true, &State->bPreviousSendInitialVelocityYawAngleWithMoveData);
+
+	TArray<UWorld*, TInlineAllocator<8>> Worlds;
+	AlsNetworkStressTest::GetPieWorlds(Worlds);
+
+	for (auto* World : Worlds)
+	{
+		for (TActorIterator<AAlsCharacter> Iterator{World}; Iterator; ++Iterator)
+		{
+			auto* Movement{AlsNetworkStressTest::GetMovement(*Iterator)};
+			if (IsValid(Movement))
+			{
+				Movement->ResetNetworkCounters();
+			}
+		}
+	}
+
+	State->StartTime = FPlatformTime::Seconds();
+	return true;
+}
+
+class FAlsRunNetworkScenarioCommand : public IAutomationLatentCommand
+{
+private:
+	AlsNetworkStressTest::FScenarioStateRef State;
+
+	int32 PhaseIndex{-1};
+
+public:
+	explicit FAlsRunNetworkScenarioCommand(const AlsNetworkStressTest::FScenarioStateRef& NewState)
+		: State{NewState} {}
+
+	virtual bool Update() override;
+};
+
+bool FAlsRunNetworkScenarioCommand::Update()
+{
+	static const FGameplayTag Stances[]{AlsStanceTags::Standing, AlsStanceTags::Crouching};
+	static const FGameplayTag Gaits[]{AlsGaitTags::Running, AlsGaitTags::Walking, AlsGaitTags::Sprinting};
+	static const FGameplayTag RotationModes[]{AlsRotationModeTags::VelocityDirection, AlsRotationModeTags::ViewDirection};
+
+	static constexpr auto ActionsCount{static_cast<uint32>(AlsNetworkStressTest::EAction::Count)};
+
+	const auto Time{GetCurrentRunTime()};
+	const auto bFinished{Time >= AlsNetworkStressTest::ScenarioDuration};
+
+	const auto NewPhaseIndex{FMath::FloorToInt32(Time / AlsNetworkStressTest::PhaseDuration)};
+	const auto bPhaseChanged{NewPhaseIndex != PhaseIndex};
+	PhaseIndex = NewPhaseIndex;
+
+	AlsNetworkStressTest::SampleConnections(*State);
+
+	TArray<UWorld*, TInlineAllocator<8>> Worlds;
+	AlsNetworkStressTest::GetPieWorlds(Worlds);
+
+	for (auto* World : Worlds)
+	{
+		for (auto Iterator{World->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+		{
+			auto* Character{AlsNetworkStressTest::GetLocalCharacter(Iterator->Get())};
+			if (!IsValid(Character))
+			{
+				continue;
+			}
+
+			// Ragdolls from the previous phase are stopped, so that all characters are on their feet when the scenario ends.
+
+			if (bFinished || bPhaseChanged)
+			{
+				AlsNetworkStressTest::StopRagdolling(Character);
+			}
+
+			if (bFinished)
+			{
+				continue;
+			}
+
+			// Every player walks its own circle, so the characters keep changing
+			// direction and occasionally collide with each other and the level.
+
+			const auto PlayerId{Character->GetPlayerState()->GetPlayerId()};
+			const auto Angle{Time * 0.75 + PlayerId * 1.7};
+
+			Character->AddMovementInput({FMath::Cos(Angle), FMath::Sin(Angle), 0.0});
+
+			if (bPhaseChanged)
+			{
+				const auto Index{static_cast<uint32>(PhaseIndex + PlayerId)};
+
+				Character->SetDesiredStance(Stances[Index % UE_ARRAY_COUNT(Stances)]);
+				Character->SetDesiredGait(Gaits[Index % UE_ARRAY_COUNT(Gaits)]);
+				Character->SetDesiredRotationMode(RotationModes[Index % UE_ARRAY_COUNT(RotationModes)]);
+
+				AlsNetworkStressTest::StartAction(Character, static_cast<AlsNetworkStressTest::EAction>(Index % ActionsCount), *State);
+			}
+		}
+	}
+
+	return bFinished;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FAlsVerifyNetworkStateCommand, FAutomationTestBase*, Test);
+
+bool FAlsVerifyNetworkStateCommand::Update()
+{
+	TArray<UWorld*, TInlineAllocator<8>> Worlds;
+	AlsNetworkStressTest::GetPieWorlds(Worlds);
+
+	UWorld* ServerWorld{nullptr};
+
+	for (auto* World : Worlds)
+	{
+		if (World->GetNetMode() == NM_ListenServer)
+		{
+			ServerWorld = World;
+			break;
+		}
+	}
+
+	if (!Test->TestNotNull(TEXT("Server world"), ServerWorld))
+	{
+		return true;
+	}
+
+	auto MaxLocationError{0.0};
+
+	for (TActorIterator<AAlsCharacter> Iterator{ServerWorld}; Iterator; ++Iterator)
+	{
+		const auto* ServerCharacter{*Iterator};
+		const auto* PlayerState{ServerCharacter->GetPlayerState()};
+		if (!IsValid(PlayerState))
+		{
+			continue;
+		}
+
+		for (auto* World : Worlds)
+		{
+			if (World == ServerWorld)
+			{
+				continue;
+			}
+
+			const auto* ClientCharacter{AlsNetworkStressTest::FindCharacterByPlayerId(World, PlayerState->GetPlayerId())};
+			if (!Test->TestNotNull(FString::Printf(TEXT("Character of player %d in %s"), PlayerState->GetPlayerId(), *World->GetName()),
+			                       ClientCharacter))
+			{
+				continue;
+			}
+
+			const auto Context{
+				FString::Printf(TEXT("Player %d (%s) in %s"), PlayerState->GetPlayerId(),
+				                *UEnum::GetValueAsString(ClientCharacter->GetLocalRole()), *World->GetName())
+			};
+
+			const auto LocationError{FVector::Dist(ServerCharacter->GetActorLocation(), ClientCharacter->GetActorLocation())};
+			MaxLocationError = FMath::Max(MaxLocationError, LocationError);
+
+			Test->TestTrue(FString::Printf(TEXT("%s: location error %.2f is within %.2f"), *Context,
+			                               LocationError, AlsNetworkStressTest::MaxLocationError),
+			               LocationError <= AlsNetworkStressTest::MaxLocationError);
+
+			Test->TestEqual(Context + TEXT(": desired stance"),
+			                ClientCharacter->GetDesiredStance().ToString(), ServerCharacter->GetDesiredStance().ToString());
+			Test->TestEqual(Context + TEXT(": desired gait"),
+			                ClientCharacter->GetDesiredGait().ToString(), ServerCharacter->GetDesiredGait().ToString());
+			Test->TestEqual(Context + TEXT(": desired rotation mode"),
+			                ClientCharacter->GetDesiredRotationMode().ToString(), ServerCharacter->GetDesiredRotationMode().ToString());
+
+			Test->TestEqual(Context + TEXT(": stance"),
+			                ClientCharacter->GetStance().ToString(), ServerCharacter->GetStance().ToString());
+			Test->TestEqual(Context + TEXT(": locomotion mode"),
+			                ClientCharacter->GetLocomotionMode().ToString(), ServerCharacter->GetLocomotionMode().ToString());
+		}
+	}
+
+	Test->AddInfo(FString::Printf(TEXT("Max settled location error: %.2f"), MaxLocationError));
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_THREE_PARAMETER(FAlsVerifyMoveDataCommand, FAutomationTestBase*, Test,
+                                                 AlsNetworkStressTest::FScenarioStateRef, State, int32, PacketLoss);
+
+bool FAlsVerifyMoveDataCommand::Update()
+{
+	TArray<UWorld*, TInlineAllocator<8>> Worlds;
+	AlsNetworkStressTest::GetPieWorlds(Worlds);
+
+	UWorld* ServerWorld{nullptr};
+
+	for (auto* World : Worlds)
+	{
+		if (World->GetNetMode() == NM_ListenServer)
+		{
+			ServerWorld = World;
+			break;
+		}
+	}
+
+	if (!Test->TestNotNull(TEXT("Server world"), ServerWorld))
+	{
+		return true;
+	}
+
+	auto ServerMovesCount{0};
+	auto ServerCorrectionsCount{0};
+	uint64 ServerMovesCycles{0};
+	auto CombinedMovesCount{0};
+
+	for (auto* World : Worlds)
+	{
+		if (World == ServerWorld)
+		{
+			continue;
+		}
+
+		for (auto Iterator{World->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+		{
+			const auto* ClientCharacter{AlsNetworkStressTest::GetLocalCharacter(Iterator->Get())};
+			const auto* ClientMovement{AlsNetworkStressTest::GetMovement(ClientCharacter)};
+			if (!IsValid(ClientMovement))
+			{
+				continue;
+			}
+
+			const auto PlayerId{ClientCharacter->GetPlayerState()->GetPlayerId()};
+
+			const auto* ServerMovement{
+				AlsNetworkStressTest::GetMovement(AlsNetworkStressTest::FindCharacterByPlayerId(ServerWorld, PlayerId))
+			};
+
+			if (!Test->TestNotNull(FString::Printf(TEXT("Server movement of player %d"), PlayerId), ServerMovement))
+			{
+				continue;
+			}
+
+			const auto& ClientCounters{ClientMovement->GetNetworkCounters()};
+			const auto& ServerCounters{ServerMovement->GetNetworkCounters()};
+
+			ServerMovesCount += ServerCounters.ServerMovesCount;
+			ServerCorrectionsCount += ServerCounters.ServerCorrectionsCount;
+			ServerMovesCycles += ServerCounters.ServerMovesCycles;
+			CombinedMovesCount += ClientCounters.CombinedMovesCount;
+
+			// Every player starts moving at least once, so every client must have sent the initial velocity yaw angle, and
+			// since the moves that carry it are resent until acknowledged, the last one must have arrived on the server.
+
+			const auto Context{FString::Printf(TEXT("Player %d"), PlayerId)};
+
+			Test->TestTrue(Context + TEXT(": initial velocity yaw angle sent with move data"),
+			               ClientCounters.SentInitialVelocityYawAnglesCount > 0);
+
+			Test->TestTrue(Context + TEXT(": initial velocity yaw angle received by the server"),
+			               ServerCounters.ReceivedInitialVelocityYawAnglesCount > 0);
+
+			const auto YawAngleError{
+				FMath::Abs(FMath::FindDeltaAngleDegrees(ClientCounters.LastSentInitialVelocityYawAngle,
+				                                        ServerCounters.LastReceivedInitialVelocityYawAngle))
+			};
+
+			Test->TestTrue(FString::Printf(TEXT("%s: last initial velocity yaw angle error %g is within %g"), *Context,
+			                               YawAngleError, AlsNetworkStressTest::MaxInitialVelocityYawAngleError),
+			               YawAngleError <= AlsNetworkStressTest::MaxInitialVelocityYawAngleError);
+		}
+	}
+
+	if (PacketLoss <= AlsNetworkStressTest::MaxPacketLossWithCombinedMoves)
+	{
+		Test->TestTrue(TEXT("Saved moves combined"), CombinedMovesCount > 0);
+	}
+
+	const auto Duration{FMath::Max(FPlatformTime::Seconds() - State->StartTime, UE_DOUBLE_SMALL_NUMBER)};
+	const auto FramesCount{FMath::Max(1, State->FramesCount)};
+
+	int64 PropertyBits;
+	int64 RpcBits;
+	AlsNetworkStats::GetTotalBits(PropertyBits, RpcBits);
+
+	Test->AddInfo(FString::Printf(TEXT("Moves: %d server moves, %d corrections, %d combined moves, %.2f us per server move."),
+	                              ServerMovesCount, ServerCorrectionsCount, CombinedMovesCount,
+	                              FPlatformTime::ToMilliseconds64(ServerMovesCycles) * 1000.0 / FMath::Max(1, ServerMovesCount)));
+
+	Test->AddInfo(FString::Printf(TEXT("Bandwidth: server %.0f bytes/s, clients %.0f bytes/s in total. ALS payload:")
+	                              TEXT(" %.0f property bits/s, %.0f RPC bits/s."),
+	                              static_cast<double>(State->ServerOutBytesPerSecondSum) / FramesCount,
+	                              static_cast<double>(State->ClientsOutBytesPerSecondSum) / FramesCount,
+	                              PropertyBits / Duration, RpcBits / Duration));
+
+	Test->AddInfo(FString::Printf(TEXT("Reliable buffer: max %d of %d outgoing reliable bunches per channel, max %d queued bits."),
+	                              State->MaxOutgoingReliableBunchesCount, RELIABLE_BUFFER, State->MaxQueuedBits));
+
+	Test->AddInfo(FString::Printf(TEXT("Actions: %d of %d mantling attempts started, %d rolls, %d ragdolls."),
+	                              State->MantlingStartsCount, State->MantlingAttemptsCount,
+	                              State->RollingStartsCount, State->RagdollingStartsCount));
+
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FAlsEndNetworkMeasurementCommand, AlsNetworkStressTest::FScenarioStateRef, State);
+
+bool FAlsEndNetworkMeasurementCommand::Update()
+{
+	auto* NetworkStatsVariable{IConsoleManager::Get().FindConsoleVariable(TEXT("Als.NetworkStats.Enable"))};
+	if (NetworkStatsVariable != nullptr)
+	{
+		NetworkStatsVariable->Set(State->bPreviousNetworkStatsEnabled, ECVF_SetByCode);
+	}
+
+	AlsNetworkStressTest::SetSendInitialVelocityYawAngleWithMoveData(State->bPreviousSendInitialVelocityYawAngleWithMoveData);
+	return true;
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FAlsNetworkStressTest, "Als.Network.Stress",
+                                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+void FAlsNetworkStressTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	OutBeautifiedNames.Add(TEXT("PktLag 100 PktLoss 2"));
+	OutTestCommands.Add(TEXT("100 2"));
+
+	OutBeautifiedNames.Add(TEXT("PktLag 250 PktLoss 10"));
+	OutTestCommands.Add(TEXT("250 10"));
+}
+
+bool FAlsNetworkStressTest::RunTest(const FString& Parameters)
+{
+	FString PacketLagString;
+	FString PacketLossString;
+
+	if (!Parameters.Split(TEXT(" "), &PacketLagString, &PacketLossString))
+	{
+		AddError(FString::Printf(TEXT("Invalid test parameters: %s."), *Parameters));
+		return false;
+	}
+
+	const auto PacketLag{FCString::Atoi(*PacketLagString)};
+	const auto PacketLoss{FCString::Atoi(*PacketLossString)};
+
+	if (!AutomationOpenMap(AlsNetworkStressTest::MapName))
+	{
+		AddError(FString::Printf(TEXT("Failed to load %s."), AlsNetworkStressTest::MapName));
+		return false;
+	}
+
+	const auto State{MakeShared<AlsNetworkStressTest::FScenarioState>()};
+
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsStartNetworkPlaySessionCommand)
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsWaitForNetworkPlayersCommand{this})
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsSetNetEmulationCommand{PacketLag, PacketLoss})
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsBeginNetworkMeasurementCommand{State})
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsRunNetworkScenarioCommand{State})
+
+	// Keep the emulated network conditions while the characters settle so that the last corrections arrive through it too.
+
+	ADD_LATENT_AUTOMATION_COMMAND(FEngineWaitLatentCommand{AlsNetworkStressTest::SettleDuration})
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsVerifyNetworkStateCommand{this})
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsVerifyMoveDataCommand{this, State, PacketLoss})
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsEndNetworkMeasurementCommand{State})
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsSetNetEmulationCommand{0, 0})
+	ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand)
+
+	return true;
+}
+
+#endif